@@ -5,6 +5,9 @@
 namespace gost
 {
 
+// RFC 9058 limit for a 64-bit block: len(A) + len(C) in bits is at most 2^32 - 1
+constexpr size_t MGM_MAX_SIZE = (size_t(1) << 29) - 1;
+
 class Crypter
 {
 public:
@@ -12,10 +15,34 @@ public:
 	~Crypter() = default;
 
 	void cryptData(const byte* scr, byte* dst, size_t size, const byte* password);
+	// cryptData() that also writes Hasher::hash() of the plaintext in the same pass over it, src may be dst
+	void cryptDataAndHash(const byte* src, byte* dst, size_t size, const byte* password, byte* hash);
+	// turns cryptData() output under oldPassword into the one under newPassword in place, in a single pass
+	void recryptData(byte* data, size_t size, const byte* oldPassword, const byte* newPassword);
+	// GOST R 34.13-2015 CTR mode of Magma. This and the other Magma modes below always use the fixed table
+	// of GOST R 34.12-2015, whatever table the Crypter has for cryptData() and the key wrap.
+	// The key is big-endian as in GOST R 34.12-2015, iv is the upper half of the first counter block
+	void cryptCtr(const byte* src, byte* dst, size_t size, const byte* key, u32 iv);
+	// RFC 8645 CTR-ACPKM of Magma: cryptCtr() with the key changed every sectionSize bytes.
+	// Returns false for a sectionSize that is 0 or not a multiple of 8
+	bool cryptCtrAcpkm(const byte* src, byte* dst, size_t size, const byte* key, u32 iv, size_t sectionSize);
+	// RFC 9058 MGM authenticated encryption of Magma. The nonce is 8 bytes with the top bit ignored, the tag is 8 bytes.
+	// Both return false, touching nothing, when ad and data together exceed MGM_MAX_SIZE bytes.
+	// mgmDecrypt() also returns false and wipes dst if the tag does not match
+	bool mgmEncrypt(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, byte* tag);
+	bool mgmDecrypt(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, const byte* tag);
+	// RFC 4357 CryptoPro key wrap: UKM | ECB(KEK(UKM), key) | MAC(KEK(UKM), UKM, key).
+	// unwrapKey() returns false and wipes the key if the MAC does not match
+	void wrapKey(const MasterKeyBytes& key, const byte* kek, const UkmBytes& ukm, WrappedKey& wrapped);
+	bool unwrapKey(const WrappedKey& wrapped, const byte* kek, MasterKeyBytes& key);
+	// the same for n keys under one kek, processed lane by lane
+	void wrapKeys(const MasterKeyBytes* keys, const byte* kek, const UkmBytes* ukms, WrappedKey* wrapped, size_t n);
+	void unwrapKeys(const WrappedKey* wrapped, const byte* kek, MasterKeyBytes* keys, bool* ok, size_t n);
 	void cryptString(const char* scr, byte* dst, const byte* password);
 	void decryptString(const byte* scr, char* dst, size_t size, const byte* password);
 
 	void useDefaultTable();
+	void useMagmaTable();  // fixed table of GOST R 34.12-2015 Magma
 	void setTable(const char* filename); // file with 128 bytes representing SBox table for GOST encryption
 	void setTable(const byte* table);    // 128 bytes representing SBox table for GOST encryption
 
@@ -28,6 +55,14 @@ private:
 	u32 X[8]; // splitted key
 
 	void cryptBlock(u32& A, u32& B);
+	void cryptBlocks(u32* A, u32* B, size_t n, const u32* key, const u32 (*table)[256]);
+	void cryptBlocksKeyed(u32* A, u32* B, size_t n, const u32* const* keys, const u8* rounds, u8 count);
+	void diversifyKeys(u32 (*keks)[8], const UkmBytes* ukms, size_t n);
+	void cryptCtrRange(const byte* src, byte* dst, size_t size, const u32* key, u64 counter, u64 counterMask);
+	u64 mgmSum(const byte* data, size_t size, const u32* key, u64 z);
+	u64 mgm(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, bool encrypt);
+	void acpkm(const u32* key, u32* next);
+	void cryptGamma(const byte* src, byte* dst, size_t size, u32 N3, u32 N4, size_t offset);
 	u32 f(u32 word);
 };
 
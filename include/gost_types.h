@@ -7,11 +7,16 @@ namespace gost
 
 constexpr size_t SIZE_OF_KEY = 32;
 constexpr size_t SIZE_OF_HASH = 64;
+constexpr size_t SIZE_OF_HASH_256 = 32;
 constexpr size_t SIZE_OF_SALT = 6;
+constexpr size_t SIZE_OF_UKM = 8;
+constexpr size_t SIZE_OF_WRAPPED_KEY = SIZE_OF_UKM + SIZE_OF_KEY + 4;
 
 using MasterKeyBytes = SecuredByteArray<SIZE_OF_KEY>;
 using HashBytes = SecuredByteArray<SIZE_OF_HASH>;
 using SaltBytes = SecuredByteArray<SIZE_OF_SALT>;
+using UkmBytes = std::array<byte, SIZE_OF_UKM>;
+using WrappedKey = std::array<byte, SIZE_OF_WRAPPED_KEY>;
 
 using GostMasterKey = MasterKey<SIZE_OF_KEY>;
 using GostKeyGuard = MasterKeyGuard<SIZE_OF_KEY>;
@@ -24,6 +29,21 @@ struct HashAndSalt
 
 HashBytes getHash(const GostKeyGuard& keyGuard, const SaltBytes& salt);
 HashAndSalt getHash(const GostKeyGuard& keyGuard);
+// getHash() of n keys with their salts, hashed several at a time by Hasher::hashMany()
+void getHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, HashBytes* hashes, size_t n);
+
+// The same with PBKDF2-HMAC-Streebog-512 of `iterations` rounds instead of a single hash,
+// meant for stored verifiers. The results differ from the ones of the single hash
+HashBytes getHash(const GostKeyGuard& keyGuard, const SaltBytes& salt, u64 iterations);
+HashAndSalt getHash(const GostKeyGuard& keyGuard, u64 iterations);
+void getHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, HashBytes* hashes, size_t n, u64 iterations);
+
+// Checks n credentials at once: bit i % 64 of matches[i / 64] is set when getHash() of key i
+// with salt i is expected[i]. The hashes are computed as the batch getHash() does, into one
+// buffer that is wiped afterwards, and compared in constant time. matches takes (n + 63) / 64 words
+void verifyHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, const HashBytes* expected, size_t n, u64* matches);
+// the same for the PBKDF2 verifiers
+void verifyHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, const HashBytes* expected, size_t n, u64 iterations, u64* matches);
 
 } // namespace gost
 
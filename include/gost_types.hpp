@@ -1,5 +1,6 @@
 #include "gost_types.h"
 #include "hash.h"
+#include "kdf.h"
 
 namespace gost
 {
@@ -27,6 +28,37 @@ inline HashBytes getHash(const GostKeyGuard& keyGuard, const SaltBytes& salt)
 	return hash;
 }
 
+// getHash() of n keys into the given buffers
+inline void hashSalted(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, byte* const* dsts, size_t n)
+{
+	constexpr size_t saltedSize = SIZE_OF_KEY + SIZE_OF_SALT + staticSalt.size();
+
+	SecuredByteVector salted{ std::vector<std::byte>(n * saltedSize) };
+	std::vector<const byte*> srcs(n);
+	std::vector<size_t> sizes(n, saltedSize);
+
+	for (size_t i = 0; i < n; ++i) {
+		const auto begin = std::next(salted.begin(), i * saltedSize);
+		std::ranges::copy(keyGuards[i]->get(), begin);
+		std::ranges::copy(salts[i], std::next(begin, SIZE_OF_KEY));
+		std::ranges::copy(staticSalt, std::next(begin, SIZE_OF_KEY + SIZE_OF_SALT));
+
+		srcs[i] = reinterpret_cast<const byte*>(&*begin);
+	}
+
+	Hasher::hashMany(srcs.data(), sizes.data(), dsts, n);
+}
+
+inline void getHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, HashBytes* hashes, size_t n)
+{
+	std::vector<byte*> dsts(n);
+	for (size_t i = 0; i < n; ++i) {
+		dsts[i] = reinterpret_cast<byte*>(hashes[i].data());
+	}
+
+	hashSalted(keyGuards, salts, dsts.data(), n);
+}
+
 inline HashAndSalt getHash(const GostKeyGuard& keyGuard)
 {
 	SaltBytes salt;
@@ -37,4 +69,97 @@ inline HashAndSalt getHash(const GostKeyGuard& keyGuard)
 	return { hash, salt };
 }
 
+// PBKDF2 takes the key as the password and the salt followed by the static one
+inline void pbkdf2Salted(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, byte* const* dsts, size_t n, u64 iterations)
+{
+	constexpr size_t saltedSize = SIZE_OF_SALT + staticSalt.size();
+
+	SecuredByteVector salted{ std::vector<std::byte>(n * saltedSize) };
+	std::vector<const byte*> passwords(n);
+	std::vector<size_t> passwordSizes(n, SIZE_OF_KEY);
+	std::vector<const byte*> saltPtrs(n);
+	std::vector<size_t> saltSizes(n, saltedSize);
+
+	for (size_t i = 0; i < n; ++i) {
+		const auto begin = std::next(salted.begin(), i * saltedSize);
+		std::ranges::copy(salts[i], begin);
+		std::ranges::copy(staticSalt, std::next(begin, SIZE_OF_SALT));
+
+		passwords[i] = reinterpret_cast<const byte*>(keyGuards[i]->get().data());
+		saltPtrs[i] = reinterpret_cast<const byte*>(&*begin);
+	}
+
+	pbkdf2Many(passwords.data(), passwordSizes.data(), saltPtrs.data(), saltSizes.data(), n, iterations, dsts, SIZE_OF_HASH);
+}
+
+inline void getHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, HashBytes* hashes, size_t n, u64 iterations)
+{
+	std::vector<byte*> dsts(n);
+	for (size_t i = 0; i < n; ++i) {
+		dsts[i] = reinterpret_cast<byte*>(hashes[i].data());
+	}
+
+	pbkdf2Salted(keyGuards, salts, dsts.data(), n, iterations);
+}
+
+inline HashBytes getHash(const GostKeyGuard& keyGuard, const SaltBytes& salt, u64 iterations)
+{
+	const GostKeyGuard* guard = &keyGuard;
+	HashBytes hash;
+
+	getHash(&guard, &salt, &hash, 1, iterations);
+	return hash;
+}
+
+inline HashAndSalt getHash(const GostKeyGuard& keyGuard, u64 iterations)
+{
+	SaltBytes salt;
+	memrandomset(salt);
+
+	HashBytes hash(getHash(keyGuard, salt, iterations));
+
+	return { hash, salt };
+}
+
+// Sets bit i of matches when computed hash i is expected[i]. Every byte of every hash is looked at,
+// and the bit comes from arithmetic on the difference rather than a branch
+inline void matchHashes(const byte* computed, const HashBytes* expected, size_t n, u64* matches)
+{
+	std::fill(matches, matches + (n + 63) / 64, 0);
+
+	for (size_t i = 0; i < n; ++i) {
+		u32 diff = 0;
+		for (size_t k = 0; k < SIZE_OF_HASH; ++k) {
+			diff |= computed[i * SIZE_OF_HASH + k] ^ static_cast<byte>(expected[i][k]);
+		}
+
+		// diff is at most 0xFF, so diff - 1 borrows only when it is 0
+		matches[i / 64] |= u64((diff - 1) >> 8 & 1) << (i % 64);
+	}
+}
+
+inline void verifyHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, const HashBytes* expected, size_t n, u64* matches)
+{
+	SecuredByteVector computed{ std::vector<std::byte>(n * SIZE_OF_HASH) };
+	std::vector<byte*> dsts(n);
+	for (size_t i = 0; i < n; ++i) {
+		dsts[i] = reinterpret_cast<byte*>(computed.data()) + i * SIZE_OF_HASH;
+	}
+
+	hashSalted(keyGuards, salts, dsts.data(), n);
+	matchHashes(reinterpret_cast<const byte*>(computed.data()), expected, n, matches);
+}
+
+inline void verifyHash(const GostKeyGuard* const* keyGuards, const SaltBytes* salts, const HashBytes* expected, size_t n, u64 iterations, u64* matches)
+{
+	SecuredByteVector computed{ std::vector<std::byte>(n * SIZE_OF_HASH) };
+	std::vector<byte*> dsts(n);
+	for (size_t i = 0; i < n; ++i) {
+		dsts[i] = reinterpret_cast<byte*>(computed.data()) + i * SIZE_OF_HASH;
+	}
+
+	pbkdf2Salted(keyGuards, salts, dsts.data(), n, iterations);
+	matchHashes(reinterpret_cast<const byte*>(computed.data()), expected, n, matches);
+}
+
 } // namespace gost
@@ -1,14 +1,109 @@
 #pragma once
 
 #include "secure_types.h"
+#include <memory>
 
 namespace gost
 {
 
+constexpr size_t SIZE_OF_TREE_HASH = 8 + 1 + 64;
+// treeHash() limits, so that a result from elsewhere cannot make treeHashMatches() hash every
+// few bytes on their own or hold more digests than a fraction of the data
+constexpr u64 TREE_MIN_LEAF = 1024;
+constexpr u64 TREE_MAX_LEAVES = u64(1) << 24;
+// magic, version, digest size, buffered bytes, reserved byte, byte count, h, N, Sigma, buffer
+constexpr size_t SIZE_OF_HASHER_STATE = 4 + 1 + 1 + 1 + 1 + 8 + 4 * 64;
+
+struct KeySchedule;
+
 class Hasher
 {
 public:
+	// digestSize is 64 for Streebog-512 or 32 for Streebog-256, anything else throws std::invalid_argument
+	explicit Hasher(size_t digestSize = 64);
+	Hasher(const Hasher&) = default;
+	Hasher& operator=(const Hasher&) = default;
+	~Hasher();
+
 	static void hash(const byte* src, byte* hash, size_t srcLength);
+	// the same for the 256-bit digest, which is the upper half of a run started from another IV
+	static void hash256(const byte* src, byte* hash, size_t srcLength);
+	// hash() or hash256() of n independent messages, several of them at a time in SIMD lanes,
+	// and large batches on several threads. It pays off for many short messages.
+	// Returns false and hashes nothing when digestSize is neither 64 nor 32
+	static bool hashMany(const byte* const* srcs, const size_t* sizes, byte* const* hashes, size_t n, size_t digestSize = 64);
+
+	// Parallel tree mode. This is NOT Streebog of the data and only another treeHash() can check it.
+	// The data is cut into leafSize leaves hashed on all cores, and their digests are combined by
+	// `fanout` up to one root. The result is leafSize (8 bytes, little-endian), fanout (1 byte), then
+	// the 64-byte digest, which covers both parameters and the data size. It does not depend on the number
+	// of threads. Returns false for leafSize below TREE_MIN_LEAF, fanout below 2 or more than
+	// TREE_MAX_LEAVES leaves
+	static bool treeHash(const byte* src, size_t size, byte* result, u64 leafSize = 1 << 20, u8 fanout = 16);
+	// recomputes treeHash() with the parameters written in result
+	static bool treeHashMatches(const byte* src, size_t size, const byte* result);
+
+	// Incremental form of hash(). The message is fed in the order hash() walks it, tail first:
+	// updateTail() takes the last `size` bytes of what is left of the message (a multiple of 64),
+	// finalHead() takes the rest of it from the front and writes the digest.
+	void updateTail(const byte* src, size_t size);
+	void finalHead(const byte* src, size_t size, byte* hash);
+
+	// Streaming form that takes the message in order. It is read as a byte string the way RFC 6986
+	// implementations see it, the first byte being the lowest one of the number hash() reads, and
+	// the digest is written the same way: final() gives hash() of the reversed message, reversed.
+	// init() starts a new message, the constructor and final() do it too
+	void init();
+	void update(const byte* src, size_t size);
+	void final(byte* hash);
+
+	// update() with one 64-byte block each and final() of n hashers in lockstep, several at a time
+	// in SIMD lanes when there are any. updateMany() needs hashers with no partial block buffered
+	static void updateMany(Hasher* const* hashers, const byte* const* blocks, size_t n);
+	static void finalMany(Hasher* const* hashers, byte* const* hashes, size_t n);
+
+	// Shared prefixes: a copy of a hasher continues from where the original is, so a prefix given
+	// to update() once can be followed by any number of tails. finalTails() gives final() of copies
+	// fed with each of n tails, running their blocks in lockstep, and leaves this hasher as it is
+	void finalTails(const byte* const* tails, const size_t* sizes, byte* const* hashes, size_t n) const;
+
+	// Checkpoints of update() runs. save() writes the state to a versioned SIZE_OF_HASHER_STATE blob,
+	// restore() takes it back and returns false, leaving the hasher as it is, for a blob that is not
+	// one. The blob tells as much about the message as the hasher does, keep it as safe as the data.
+	// processed() is the number of bytes given to update() since init(), the offset to resume from
+	void save(byte* state) const;
+	bool restore(const byte* state, size_t size);
+	u64 processed() const;
+
+	// Expands the 13 round keys of the next block, which depend on the state only. The hasher and
+	// its copies then do half of the work for that block. Worth it for a state that is copied many
+	// times, such as HMAC midstates or a shared prefix. The first block after init() always has them
+	void prepare();
+
+private:
+	// words of little-endian 512-bit numbers, the lowest first
+	u64 h[8];
+	u64 N[8];
+	u64 Sigma[8];
+	u8 buffer[64]; // partial block of update()
+	size_t buffered;
+	size_t digestSize;
+	// round keys for the current h and N, shared by the copies, dropped by the next block
+	std::shared_ptr<const KeySchedule> schedule;
+
+	void compress(const u64* m);
+	void finish(const u64* m, u64 bits);
 };
 
+// Streebog of a byte string, as update() and final() see it, for constant expressions: the compiler
+// computes constHash() of constant data. It is the scalar code of Hasher without the SIMD kernels
+// and leaves copies of the data in its locals, so it is meant for constants only.
+// The second form takes a string literal without its terminating zero
+template<size_t digestSize = 64>
+constexpr std::array<byte, digestSize> constHash(const byte* src, size_t size);
+template<size_t digestSize = 64, size_t length>
+constexpr std::array<byte, digestSize> constHash(const char (&str)[length]);
+
 } // namespace gost
+
+#include "hash.hpp"
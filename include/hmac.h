@@ -0,0 +1,33 @@
+#pragma once
+
+#include "hash.h"
+
+namespace gost
+{
+
+// RFC 7836 HMAC_GOSTR3411_2012_256 and _512 over the byte strings of Hasher::update().
+// The key is prepared once: the hashers right after the ipad and the opad blocks are kept,
+// so a message costs its own blocks and the outer finalization only
+class Hmac
+{
+public:
+	// digestSize is 64 for HMAC-512 or 32 for HMAC-256, anything else throws std::invalid_argument
+	Hmac(const byte* key, size_t keySize, size_t digestSize = 64);
+	~Hmac() = default;
+
+	void compute(const byte* src, size_t size, byte* mac) const;
+	// compute() of n independent messages, finalized several at a time in SIMD lanes
+	void computeMany(const byte* const* srcs, const size_t* sizes, byte* const* macs, size_t n) const;
+	size_t size() const { return digestSize; }
+
+	// the hashers right after the pad blocks, for running many HMACs in lockstep
+	const Hasher& innerHasher() const { return inner; }
+	const Hasher& outerHasher() const { return outer; }
+
+private:
+	Hasher inner;
+	Hasher outer;
+	size_t digestSize;
+};
+
+} // namespace gost
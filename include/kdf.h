@@ -0,0 +1,29 @@
+#pragma once
+
+#include "hmac.h"
+
+namespace gost
+{
+
+// PBKDF2 of RFC 8018 with HMAC-Streebog-512, as in R 50.1.111-2016. The 64-byte output blocks
+// are derived on separate threads. Returns false for zero iterations
+bool pbkdf2(const byte* password, size_t passwordSize, const byte* salt, size_t saltSize, u64 iterations, byte* dst, size_t dstSize);
+// pbkdf2() of n passwords with their salts: the derivations run side by side in SIMD lanes,
+// and the groups of lanes on separate threads
+bool pbkdf2Many(const byte* const* passwords, const size_t* passwordSizes, const byte* const* salts, const size_t* saltSizes,
+                size_t n, u64 iterations, byte* const* dsts, size_t dstSize);
+
+// RFC 7836 KDF_GOSTR3411_2012_256: HMAC-256 of 01 || label || 00 || seed || 01 00 under the key
+void kdf256(const byte* key, size_t keySize, const byte* label, size_t labelSize, const byte* seed, size_t seedSize,
+            SecuredByteArray<32>& dst);
+// kdf256() of n label and seed pairs under one key. The key is prepared once and the HMACs
+// are finalized several at a time in SIMD lanes, on separate threads for large n
+void kdf256Many(const byte* key, size_t keySize, const byte* const* labels, const size_t* labelSizes,
+                const byte* const* seeds, const size_t* seedSizes, size_t n, SecuredByteArray<32>* dsts);
+// RFC 7836 KDF_TREE_GOSTR3411_2012_256 with an R-byte counter. Fills dst with K(1) || K(2) || ..,
+// where K(i) is HMAC-256 of [i] || label || 00 || seed || [L] and L is the size of dst in bits.
+// Returns false for an empty dst, R outside 1..4 or more blocks than the counter can number
+bool kdfTree256(const byte* key, size_t keySize, const byte* label, size_t labelSize, const byte* seed, size_t seedSize,
+                u8 R, SecuredByteVector& dst);
+
+} // namespace gost
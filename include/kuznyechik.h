@@ -0,0 +1,22 @@
+#pragma once
+
+#include "secure_types.h"
+
+namespace gost
+{
+
+// GOST R 34.12-2015 Kuznyechik, the 128-bit block cipher. Keys and blocks are byte strings
+// in the order the standard prints them
+class Kuznyechik
+{
+public:
+	static void cryptBlock(const byte* src, byte* dst, const byte* key);
+	// GOST R 34.13-2015 CTR mode, iv is the upper half of the first counter block
+	static void cryptCtr(const byte* src, byte* dst, size_t size, const byte* key, u64 iv);
+
+private:
+	static void expandKey(const byte* key, u64 (*K)[2]);
+	static void cryptBlocks(u64 (*blocks)[2], size_t n, const u64 (*K)[2]);
+};
+
+} // namespace gost
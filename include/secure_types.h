@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <array>
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 namespace gost
@@ -29,12 +32,17 @@ class Secured;
  */
 void memwipe(void* ptr, size_t len, byte fill = 0);
 
+// dst ^= src over len bytes, a word or a vector at a time
+void memxor(void* dst, const void* src, size_t len);
+
+// Fills the buffer from a generator of the calling thread, seeded from the OS.
+// Defined in the library, safe to call from any number of threads
 void memrandomset(void* ptr, size_t len);
 
 template<typename T>
 void memrandomset(Secured<T>& bytes)
 {
-	memrandomset(reinterpret_cast<u8*>(bytes.getRaw()), bytes.size());
+	memrandomset(reinterpret_cast<u8*>(bytes.getRaw()), bytes.sizeInBytes());
 }
 
 template<typename T>
@@ -62,26 +70,70 @@ public:
 	Secured<T>& operator^=(const Secured<U>& other);
 };
 
+// Memory of the secure arena: locked in RAM and left out of core dumps where the system allows it,
+// served from per-thread free lists and wiped on free. lockedFree() takes the size given to
+// lockedAlloc(). Blocks are aligned to LOCKED_ALIGNMENT. Returns nullptr when no memory can be mapped.
+// Locking may fail silently, e.g. past RLIMIT_MEMLOCK: the memory is served unlocked then
+constexpr size_t LOCKED_ALIGNMENT = 32;
+
+void* lockedAlloc(size_t size);
+void lockedFree(void* ptr, size_t size);
+// mappings of the arena the system refused to lock so far, 0 when everything it served stayed locked
+size_t lockFailures();
+
+// Standard allocator over lockedAlloc(), for Secured containers whose buffers must not be swapped
+// out, and must not be left unwiped when a reallocation moves the data
+template<typename T>
+class SecureAllocator
+{
+public:
+	using value_type = T;
+
+	SecureAllocator() = default;
+	template<typename U>
+	SecureAllocator(const SecureAllocator<U>&) {}
+
+	T* allocate(size_t n);
+	void deallocate(T* p, size_t n);
+
+	template<typename U>
+	bool operator==(const SecureAllocator<U>&) const { return true; }
+};
+
 template<size_t N>
 using SecuredByteArray = Secured<std::array<std::byte, N>>;
 using SecuredByteVector = Secured<std::vector<std::byte>>;
+// SecuredByteVector in locked memory
+using LockedByteVector = Secured<std::vector<std::byte, SecureAllocator<std::byte>>>;
 
 template<size_t SIZE_OF_KEY>
 class MasterKeyGuard;
 
+// A key kept XORed with a random mask while no guard is using it. Any number of threads may hold
+// guards at once: the first one unmasks the key, the last one masks it back, and the guards taken
+// while it is unmasked only count themselves. The mask is drawn anew every REMASK_INTERVAL maskings
 template<size_t SIZE_OF_KEY>
 class MasterKey
 {
 	friend class MasterKeyGuard<SIZE_OF_KEY>;
 
 public:
+	static constexpr u32 REMASK_INTERVAL = 1024;
+
 	template<typename T>
 	explicit MasterKey(Secured<T>&& key);
+	MasterKey(const MasterKey&) = delete;
+	MasterKey& operator=(const MasterKey&) = delete;
 
 private:
 	mutable SecuredByteArray<SIZE_OF_KEY> m_data;
 	mutable SecuredByteArray<SIZE_OF_KEY> m_x;
+	mutable std::atomic<size_t> m_readers = 0;
+	mutable std::mutex m_mutex; // taken by the first and the last reader
+	mutable u32 m_maskings = 0;
 
+	void acquire() const;
+	void release() const;
 	void lock() const;
 	void unlock() const;
 };
@@ -1,34 +1,90 @@
 #include "secure_types.h"
 
-#include <random>
 #include <bit>
 #include <functional>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <cstdint>
 
 namespace gost
 {
 
+// A plain memset() with the wide stores of the C library. The empty asm that takes the pointer
+// and clobbers memory makes the compiler assume the bytes are read after it, so the memset() stays.
+// Other compilers get volatile stores, a word at a time
 inline void memwipe(void* ptr, size_t len, byte fill /*= 0*/)
 {
+#if defined(__GNUC__) || defined(__clang__)
+	memset(ptr, fill, len);
+	__asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
 	volatile char* vptr = std::bit_cast<volatile char*>(ptr);
-	while (len) {
+	while (len && reinterpret_cast<uintptr_t>(vptr) % sizeof(u64) != 0) {
 		*vptr = fill;
 		++vptr;
 		--len;
 	}
-}
 
-inline void memrandomset(void* ptr, size_t len)
-{
-	static std::random_device dev;
-	static std::mt19937 rng(dev());
-	static std::uniform_int_distribution<> dist;
+	const u64 word = fill * 0x0101010101010101ULL;
+	for (; len >= sizeof(u64); len -= sizeof(u64), vptr += sizeof(u64)) {
+		*reinterpret_cast<volatile u64*>(vptr) = word;
+	}
 
-	volatile char* vptr = std::bit_cast<volatile char*>(ptr);
 	while (len) {
-		*vptr = static_cast<byte>(dist(rng));
+		*vptr = fill;
 		++vptr;
 		--len;
 	}
+#endif
+}
+
+// Words go through memcpy(), which the compiler turns into plain loads and stores,
+// and the loop into vector code
+inline void memxor(void* dst, const void* src, size_t len)
+{
+	byte* d = static_cast<byte*>(dst);
+	const byte* s = static_cast<const byte*>(src);
+
+	for (; len >= 4 * sizeof(u64); len -= 4 * sizeof(u64), d += 4 * sizeof(u64), s += 4 * sizeof(u64)) {
+		u64 a[4];
+		u64 b[4];
+		memcpy(a, d, sizeof(a));
+		memcpy(b, s, sizeof(b));
+		for (int i = 0; i < 4; ++i) {
+			a[i] ^= b[i];
+		}
+		memcpy(d, a, sizeof(a));
+	}
+
+	for (; len; --len) {
+		*d++ ^= *s++;
+	}
+}
+
+template<typename T>
+inline T* SecureAllocator<T>::allocate(size_t n)
+{
+	static_assert(alignof(T) <= LOCKED_ALIGNMENT, "the secure arena aligns its blocks to LOCKED_ALIGNMENT only");
+
+	if (n > SIZE_MAX / sizeof(T)) {
+		throw std::bad_array_new_length();
+	}
+
+	// the allocator requirements leave no other way to fail
+	void* p = lockedAlloc(n * sizeof(T));
+	if (!p) {
+		throw std::bad_alloc();
+	}
+
+	return static_cast<T*>(p);
+}
+
+template<typename T>
+inline void SecureAllocator<T>::deallocate(T* p, size_t n)
+{
+	lockedFree(p, n * sizeof(T));
 }
 
 template<typename T>
@@ -54,7 +110,7 @@ inline Secured<T>::~Secured()
 template<typename T>
 inline /*static*/ u8 Secured<T>::sizeOfElement()
 {
-	return sizeof(T::value_type);
+	return sizeof(typename T::value_type);
 }
 
 template<typename T>
@@ -82,12 +138,22 @@ template<typename T>
 template<typename U>
 inline Secured<T>& Secured<T>::operator^=(const Secured<U>& other)
 {
-	std::ranges::transform(
-		*this,
-		other,
-		T::begin(),
-		std::bit_xor<typename T::value_type>()
-	);
+	using Element = typename T::value_type;
+	using OtherElement = typename U::value_type;
+
+	// byte-like elements of the same size are XORed as memory, up to the shorter of the two
+	if constexpr (sizeof(Element) == 1 && sizeof(OtherElement) == 1
+	              && std::is_trivially_copyable_v<Element> && std::is_trivially_copyable_v<OtherElement>) {
+		memxor(getRaw(), other.data(), std::min<size_t>(T::size(), other.size()));
+	}
+	else {
+		std::ranges::transform(
+			*this,
+			other,
+			T::begin(),
+			std::bit_xor<typename T::value_type>()
+		);
+	}
 
 	return *this;
 }
@@ -98,15 +164,53 @@ inline MasterKey<SIZE_OF_KEY>::MasterKey(Secured<T>&& key)
 {
 	memcpy(m_data.data(), reinterpret_cast<std::byte*>(key.getRaw()), key.sizeInBytes());
 	memwipe(m_data.data() + key.sizeInBytes(), SIZE_OF_KEY - key.sizeInBytes());
-	key.~Secured();
+	// wiped rather than destroyed, the caller still owns and destroys it
+	memwipe(key.getRaw(), key.sizeInBytes());
 
 	lock();
 }
 
+template<size_t SIZE_OF_KEY>
+inline void MasterKey<SIZE_OF_KEY>::acquire() const
+{
+	// the key is unmasked for as long as there are readers, so joining them needs no lock
+	size_t readers = m_readers.load(std::memory_order_relaxed);
+	while (readers != 0) {
+		if (m_readers.compare_exchange_weak(readers, readers + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+			return;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_readers.load(std::memory_order_relaxed) == 0) {
+		unlock();
+	}
+	m_readers.fetch_add(1, std::memory_order_release);
+}
+
+template<size_t SIZE_OF_KEY>
+inline void MasterKey<SIZE_OF_KEY>::release() const
+{
+	size_t readers = m_readers.load(std::memory_order_relaxed);
+	while (readers > 1) {
+		if (m_readers.compare_exchange_weak(readers, readers - 1, std::memory_order_release, std::memory_order_relaxed)) {
+			return;
+		}
+	}
+
+	// possibly the last reader, unless another one joins before the count drops
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_readers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		this->lock();
+	}
+}
+
 template<size_t SIZE_OF_KEY>
 inline void MasterKey<SIZE_OF_KEY>::lock() const
 {
-	memrandomset(m_x);
+	if (m_maskings++ % REMASK_INTERVAL == 0) {
+		memrandomset(m_x);
+	}
 	m_data ^= m_x;
 }
 
@@ -120,13 +224,13 @@ template<size_t SIZE_OF_KEY>
 inline MasterKeyGuard<SIZE_OF_KEY>::MasterKeyGuard(const MasterKey<SIZE_OF_KEY>& master)
 	: m_master(master)
 {
-	m_master.unlock();
+	m_master.acquire();
 }
 
 template<size_t SIZE_OF_KEY>
 inline MasterKeyGuard<SIZE_OF_KEY>::~MasterKeyGuard()
 {
-	m_master.lock();
+	m_master.release();
 }
 
 template<size_t SIZE_OF_KEY>
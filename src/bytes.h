@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace gost
+{
+
+static inline uint32_t bswap32(uint32_t x)
+{
+	return x >> 24 | (x >> 8 & 0xFF00) | (x << 8 & 0xFF0000) | x << 24;
+}
+
+static inline uint64_t bswap64(uint64_t x)
+{
+	x = (x & 0x00FF00FF00FF00FFULL) << 8 | (x >> 8 & 0x00FF00FF00FF00FFULL);
+	x = (x & 0x0000FFFF0000FFFFULL) << 16 | (x >> 16 & 0x0000FFFF0000FFFFULL);
+	return x << 32 | x >> 32;
+}
+
+} // namespace gost
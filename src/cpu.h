@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GOST_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// Lets a single function use instructions the rest of the library is not compiled for.
+// MSVC needs nothing for that, the callers check the CPU before calling such a function.
+#ifdef __GNUC__
+#define GOST_TARGET(features) __attribute__((target(features)))
+#else
+#define GOST_TARGET(features)
+#endif
+
+namespace gost::cpu
+{
+
+enum class Simd { Scalar, Avx2, Avx512 };
+
+// The highest level the checks below may report. GOST_SIMD=scalar or GOST_SIMD=avx2 in the environment
+// lowers it, so the tests can run the other code paths on the same machine. It is read once
+inline Simd simdLimit()
+{
+	static const Simd limit = [] {
+		const char* value = std::getenv("GOST_SIMD");
+		if (value && strcmp(value, "scalar") == 0) {
+			return Simd::Scalar;
+		}
+		if (value && strcmp(value, "avx2") == 0) {
+			return Simd::Avx2;
+		}
+		return Simd::Avx512;
+	}();
+	return limit;
+}
+
+#ifdef GOST_X86
+
+#ifdef _MSC_VER
+inline bool cpuidBit(int leaf, int reg, int bit)
+{
+	int info[4];
+	__cpuidex(info, leaf, 0);
+	return (info[reg] >> bit) & 1;
+}
+
+inline bool osSaves(unsigned long long xcr0Mask)
+{
+	return cpuidBit(1, 2, 27) && (_xgetbv(0) & xcr0Mask) == xcr0Mask;
+}
+
+inline bool hasAvx2()
+{
+	static const bool has = simdLimit() >= Simd::Avx2 && osSaves(0x06) && cpuidBit(7, 1, 5);
+	return has;
+}
+
+inline bool hasAvx512()
+{
+	static const bool has = simdLimit() >= Simd::Avx512 && osSaves(0xe6) && cpuidBit(7, 1, 16);
+	return has;
+}
+
+inline bool hasPclmul()
+{
+	static const bool has = simdLimit() > Simd::Scalar && cpuidBit(1, 2, 1);
+	return has;
+}
+#else
+inline bool hasAvx2()
+{
+	static const bool has = simdLimit() >= Simd::Avx2 && __builtin_cpu_supports("avx2");
+	return has;
+}
+
+inline bool hasAvx512()
+{
+	static const bool has = simdLimit() >= Simd::Avx512 && __builtin_cpu_supports("avx512f");
+	return has;
+}
+
+inline bool hasPclmul()
+{
+	static const bool has = simdLimit() > Simd::Scalar && __builtin_cpu_supports("pclmul");
+	return has;
+}
+#endif
+
+#else
+
+inline bool hasAvx2() { return false; }
+inline bool hasAvx512() { return false; }
+inline bool hasPclmul() { return false; }
+
+#endif
+
+} // namespace gost::cpu
@@ -1,5 +1,12 @@
 #include "crypt.h"
+#include "hash.h"
+#include "parallel.h"
+#include "bytes.h"
+#include "cpu.h"
 #include <fstream>
+#include <cstring>
+#include <thread>
+#include <atomic>
 
 namespace gost
 {
@@ -141,6 +148,44 @@ static constexpr u32 defaultSBox[4][256] =
 	}
 };
 
+// id-tc26-gost-28147-param-Z, the fixed table of GOST R 34.12-2015 Magma
+static constexpr byte magmaTable[8][16] =
+{
+	{ 0xc, 0x4, 0x6, 0x2, 0xa, 0x5, 0xb, 0x9, 0xe, 0x8, 0xd, 0x7, 0x0, 0x3, 0xf, 0x1 },
+	{ 0x6, 0x8, 0x2, 0x3, 0x9, 0xa, 0x5, 0xc, 0x1, 0xe, 0x4, 0x7, 0xb, 0xd, 0x0, 0xf },
+	{ 0xb, 0x3, 0x5, 0x8, 0x2, 0xf, 0xa, 0xd, 0xe, 0x1, 0x7, 0x4, 0xc, 0x9, 0x6, 0x0 },
+	{ 0xc, 0x8, 0x2, 0x1, 0xd, 0x4, 0xf, 0x6, 0x7, 0x0, 0xa, 0x5, 0x3, 0xe, 0x9, 0xb },
+	{ 0x7, 0xf, 0x5, 0xa, 0x8, 0x1, 0x6, 0xd, 0x0, 0x9, 0x3, 0xe, 0xb, 0x4, 0x2, 0xc },
+	{ 0x5, 0xd, 0xf, 0x6, 0x9, 0x2, 0xc, 0xa, 0xb, 0x7, 0x8, 0x1, 0x4, 0x3, 0xe, 0x0 },
+	{ 0x8, 0xe, 0x2, 0x5, 0x6, 0x9, 0x1, 0xc, 0xf, 0x4, 0xb, 0x0, 0xd, 0xa, 0x3, 0x7 },
+	{ 0x1, 0x7, 0xe, 0xd, 0x0, 0x5, 0x8, 0x3, 0x4, 0xf, 0xa, 0x6, 0x9, 0xc, 0xb, 0x2 },
+};
+
+// A 128-byte [8][16] table in the [4][256] form f() reads: entry k of row i holds the two substitutions
+// of byte i, already in place and rotated left by 11
+struct ExpandedTable
+{
+	u32 S[4][256];
+};
+
+static constexpr ExpandedTable expandTable(const u8 (*raw)[16])
+{
+	ExpandedTable t = {};
+
+	for (u8 i = 0, j = 0; i < 4; i++, j += 2) {
+		for (u16 k = 0; k < 256; k++) {
+			u32 S = raw[j][k & 0x0f] | raw[j + 1][k >> 4] << 4;
+			S <<= j << 2;
+			t.S[i][k] = S << 11 | S >> 21;
+		}
+	}
+
+	return t;
+}
+
+// the GOST R 34.13-2015 modes of Magma run on this one whatever table the Crypter has
+static constexpr ExpandedTable magmaSBox = expandTable(magmaTable);
+
 // INTERFACE FUNCTIONS
 Crypter::Crypter()
 {
@@ -153,6 +198,11 @@ void Crypter::useDefaultTable()
 	memcpy(SBox, defaultSBox, sizeof(u32) * 4 * 256);
 }
 
+void Crypter::useMagmaTable()
+{
+	setTable(&magmaTable[0][0]);
+}
+
 // file with 128 bytes representing SBox table for GOST encryption
 void Crypter::setTable(const char* filename)
 {
@@ -172,17 +222,8 @@ void Crypter::setTable(const char* filename)
 // this 128 bytes will be transformed to special 4*256 table (for better algorythm performance)
 void Crypter::setTable(const byte* table)
 {
-	const u8(*raw)[16] = reinterpret_cast<const u8(*)[16]>(table);
-
-	for (u8 i = 0, j = 0; i < 4; i++, j += 2) {
-		for (u16 k = 0; k < 256; k++) {
-			u32& S = SBox[i][k];
-
-			S = raw[j][k & 0x0f] | raw[j + 1][k >> 4] << 4;
-			S <<= j << 2;
-			S = S << 11 | S >> 21;
-		}
-	}
+	const ExpandedTable expanded = expandTable(reinterpret_cast<const u8(*)[16]>(table));
+	memcpy(SBox, expanded.S, sizeof(SBox));
 }
 
 void Crypter::useDefaultSync()
@@ -218,6 +259,81 @@ static inline u32 addMod32_1(u32 x, u32 y) {
 	return sum;
 }
 
+constexpr size_t ACPKM_WINDOW = 4096; // section keys of CTR-ACPKM held at once, 128 KB
+
+// addMod32_1() applied `times` times with C1, in one step
+static inline u32 addMod32_1_C1(u32 x, u64 times) {
+	if (times == 0) {
+		return x;
+	}
+
+	constexpr u64 M = 0xFFFFFFFF;
+	u64 sum = (x % M + times % M * C1) % M;
+	return sum == 0 ? 0xFFFFFFFF : static_cast<u32>(sum);
+}
+
+// Counter of the gamma mode, N3 and N4 start from the encrypted sync
+struct GammaCounter
+{
+	u32 N3;
+	u32 N4;
+
+	void seek(u64 block)
+	{
+		N3 += C2 * static_cast<u32>(block);
+		N4 = addMod32_1_C1(N4, block);
+	}
+
+	void next(u32& N1, u32& N2)
+	{
+		N2 = N4 = addMod32_1(N4, C1);
+		N1 = N3 = N3 + C2;
+	}
+};
+
+// XORs src with the gamma that fill(N1, N2, n) produces n blocks at a time, offset is the position of src in the message
+template<typename Fill>
+static void xorGamma(const byte* src, byte* dst, size_t size, size_t offset, Fill&& fill)
+{
+	size_t skip = offset % 8;
+
+	u32 N1[GAMMA_BATCH];
+	u32 N2[GAMMA_BATCH];
+	byte gamma[8];
+
+	while (size > 0) {
+		const size_t blocks = std::min(GAMMA_BATCH, (skip + size + 7) / 8);
+		fill(N1, N2, blocks);
+
+		for (size_t j = 0; j < blocks; ++j) {
+			size_t n = std::min(8 - skip, size);
+
+			if (n == 8) {
+				u32 AB[2];
+				memcpy(AB, src, 8);
+
+				AB[0] ^= N1[j];
+				AB[1] ^= N2[j];
+
+				memcpy(dst, AB, 8);
+			}
+			else {
+				memcpy(gamma, &N1[j], 4);
+				memcpy(gamma + 4, &N2[j], 4);
+
+				for (size_t i = 0; i < n; ++i) {
+					dst[i] = src[i] ^ gamma[skip + i];
+				}
+			}
+
+			src += n;
+			dst += n;
+			size -= n;
+			skip = 0;
+		}
+	}
+}
+
 void Crypter::cryptData(const byte* src, byte* dst, size_t size, const byte* password)
 {
 	if (size == 0) {
@@ -226,54 +342,485 @@ void Crypter::cryptData(const byte* src, byte* dst, size_t size, const byte* pas
 
 	memcpy(X, password, 32);
 
-	size_t remain = size % 8;
-	if (remain == 0) {
-		remain = 8;
+	u32 N3 = Sync[0];
+	u32 N4 = Sync[1];
+
+	cryptBlock(N3, N4);
+
+	parallelFor((size + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK, [&](size_t i) {
+		const size_t offset = i * PARALLEL_CHUNK;
+		cryptGamma(src + offset, dst + offset, std::min(PARALLEL_CHUNK, size - offset), N3, N4, offset);
+	});
+
+	memwipe(X, 32);
+}
+
+// GOST R 34.12-2015 keys are big-endian, K1 comes first
+static void loadMagmaKey(u32* K, const byte* key)
+{
+	for (u8 i = 0; i < 8; ++i) {
+		memcpy(&K[i], key + i * 4, 4);
+		K[i] = bswap32(K[i]);
+	}
+}
+
+void Crypter::cryptCtr(const byte* src, byte* dst, size_t size, const byte* key, u32 iv)
+{
+	u32 K[8];
+	loadMagmaKey(K, key);
+
+	parallelFor((size + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK, [&](size_t i) {
+		const size_t offset = i * PARALLEL_CHUNK;
+		cryptCtrRange(src + offset, dst + offset, std::min(PARALLEL_CHUNK, size - offset), K, (static_cast<u64>(iv) << 32) + offset / 8, ~0ULL);
+	});
+
+	memwipe(K, 32);
+}
+
+bool Crypter::cryptCtrAcpkm(const byte* src, byte* dst, size_t size, const byte* key, u32 iv, size_t sectionSize)
+{
+	if (sectionSize == 0 || sectionSize % 8 != 0) {
+		return false;
+	}
+
+	if (size == 0) {
+		return true;
+	}
+
+	const size_t sections = (size + sectionSize - 1) / sectionSize;
+	const size_t sectionsPerChunk = std::max<size_t>(1, PARALLEL_CHUNK / sectionSize);
+
+	// A section key costs four block encryptions and needs the one before it, so the keys of
+	// a window of sections are derived first and after that any of its sections can go to any
+	// worker. The window keeps the keys at a fixed size however small the sections are
+	Secured<std::vector<std::array<u32, 8>>> keys{ std::vector<std::array<u32, 8>>(std::min(sections, ACPKM_WINDOW)) };
+	loadMagmaKey(keys[0].data(), key);
+
+	for (size_t first = 0; first < sections; first += keys.size()) {
+		const size_t count = std::min(keys.size(), sections - first);
+
+		// every window but the last one is full, its last key comes before the first one of the next
+		if (first != 0) {
+			acpkm(keys[keys.size() - 1].data(), keys[0].data());
+		}
+		for (size_t j = 1; j < count; ++j) {
+			acpkm(keys[j - 1].data(), keys[j].data());
+		}
+
+		parallelFor((count + sectionsPerChunk - 1) / sectionsPerChunk, [&](size_t i) {
+			const size_t last = std::min(count, (i + 1) * sectionsPerChunk);
+
+			for (size_t j = i * sectionsPerChunk; j < last; ++j) {
+				const size_t offset = (first + j) * sectionSize;
+				cryptCtrRange(src + offset, dst + offset, std::min(sectionSize, size - offset), keys[j].data(), (static_cast<u64>(iv) << 32) + offset / 8, ~0ULL);
+			}
+		});
+	}
+
+	return true;
+}
+
+// Gamma of the counter modes, E(counter) for big-endian counter blocks. Only the bits of counterMask
+// take part in the increment: all of them in CTR, the right half in MGM
+void Crypter::cryptCtrRange(const byte* src, byte* dst, size_t size, const u32* key, u64 counter, u64 counterMask)
+{
+	xorGamma(src, dst, size, 0, [&](u32* G1, u32* G2, size_t n) {
+		for (size_t j = 0; j < n; ++j) {
+			G1[j] = static_cast<u32>(counter);
+			G2[j] = static_cast<u32>(counter >> 32);
+			counter = (counter & ~counterMask) | ((counter + 1) & counterMask);
+		}
+
+		cryptBlocks(G1, G2, n, key, magmaSBox.S);
+
+		// the gamma block is big-endian, G1 holds its lower half
+		for (size_t j = 0; j < n; ++j) {
+			u32 low = G1[j];
+			G1[j] = bswap32(G2[j]);
+			G2[j] = bswap32(low);
+		}
+	});
+}
+
+// RFC 8645 ACPKM: the next section key is the encryption of D = 80 81 .. 9f under the current one
+void Crypter::acpkm(const u32* key, u32* next)
+{
+	u32 A[4];
+	u32 B[4];
+
+	for (u8 i = 0; i < 4; ++i) {
+		const u32 d = 0x80 + i * 8;
+		B[i] = d << 24 | (d + 1) << 16 | (d + 2) << 8 | (d + 3);
+		A[i] = (d + 4) << 24 | (d + 5) << 16 | (d + 6) << 8 | (d + 7);
+	}
+
+	cryptBlocks(A, B, 4, key, magmaSBox.S);
+
+	for (u8 i = 0; i < 4; ++i) {
+		next[i * 2] = B[i];
+		next[i * 2 + 1] = A[i];
+	}
+
+	memwipe(A, sizeof(A));
+	memwipe(B, sizeof(B));
+}
+
+// Multiplication in GF(2^64) modulo x^64 + x^4 + x^3 + x + 1, summed over n pairs
+static u64 gfMulSum(const u64* a, const u64* b, size_t n)
+{
+	u64 sum = 0;
+
+	for (size_t i = 0; i < n; ++i) {
+		u64 x = a[i];
+		u64 y = b[i];
+
+		for (u8 bit = 0; bit < 64; ++bit) {
+			sum ^= x & (0 - (y & 1));
+			y >>= 1;
+			x = (x << 1) ^ (0x1B & (0 - (x >> 63)));
+		}
 	}
 
-	const byte* lastBytes = src + size - remain + 1;
+	return sum;
+}
+
+#ifdef GOST_X86
+// gfMulSum() with carry-less multiplication. The reduction is linear,
+// so the 128-bit products are summed first and reduced once
+GOST_TARGET("pclmul,sse4.1")
+static u64 gfMulSumPclmul(const u64* a, const u64* b, size_t n)
+{
+	__m128i sum = _mm_setzero_si128();
+
+	for (size_t i = 0; i < n; ++i) {
+		const __m128i x = _mm_cvtsi64_si128(static_cast<long long>(a[i]));
+		const __m128i y = _mm_cvtsi64_si128(static_cast<long long>(b[i]));
+		sum = _mm_xor_si128(sum, _mm_clmulepi64_si128(x, y, 0x00));
+	}
+
+	// x^64 = x^4 + x^3 + x + 1, the upper half is folded twice
+	const __m128i poly = _mm_cvtsi64_si128(0x1B);
+	__m128i fold = _mm_clmulepi64_si128(sum, poly, 0x01);
+	sum = _mm_xor_si128(sum, fold);
+	fold = _mm_clmulepi64_si128(fold, poly, 0x01);
+	sum = _mm_xor_si128(sum, fold);
+
+	return static_cast<u64>(_mm_cvtsi128_si64(sum));
+}
+#endif
+
+// big-endian block of up to 8 bytes, padded with zeros on the right
+static u64 loadBlock(const byte* src, size_t size)
+{
+	u64 block = 0;
+	for (size_t i = 0; i < 8; ++i) {
+		block = block << 8 | (i < size ? src[i] : 0);
+	}
+	return block;
+}
+
+// sum of H_i (x) block_i over data, where H_i = E(Z_i) and z is Z of the first block
+u64 Crypter::mgmSum(const byte* data, size_t size, const u32* key, u64 z)
+{
+	u64 H[GAMMA_BATCH];
+	u64 D[GAMMA_BATCH];
+	u32 A[GAMMA_BATCH];
+	u32 B[GAMMA_BATCH];
+
+	u64 sum = 0;
 
-	u32 AB[2]{};
-	u32& A = AB[0];
-	u32& B = AB[1];
+	while (size > 0) {
+		const size_t n = std::min(GAMMA_BATCH, (size + 7) / 8);
 
-	u32 N1, N2, N3, N4;
+		for (size_t j = 0; j < n; ++j) {
+			A[j] = static_cast<u32>(z);
+			B[j] = static_cast<u32>(z >> 32);
+			z += 1ULL << 32; // Z increments its left half
 
-	N3 = Sync[0];
-	N4 = Sync[1];
+			D[j] = loadBlock(data, std::min<size_t>(8, size));
+			data += std::min<size_t>(8, size);
+			size -= std::min<size_t>(8, size);
+		}
+
+		cryptBlocks(A, B, n, key, magmaSBox.S);
+
+		for (size_t j = 0; j < n; ++j) {
+			H[j] = static_cast<u64>(B[j]) << 32 | A[j];
+		}
+
+#ifdef GOST_X86
+		if (cpu::hasPclmul()) {
+			sum ^= gfMulSumPclmul(H, D, n);
+			continue;
+		}
+#endif
+		sum ^= gfMulSum(H, D, n);
+	}
+
+	memwipe(H, sizeof(H));
+	return sum;
+}
+
+// Runs MGM over the message and returns the tag. Every 64 KB of ad and of data is a separate work item
+// with its own share of the H sum: encryption blocks Y_i and authentication blocks Z_i only depend on the
+// position. Data is authenticated as ciphertext, so it is crypted first when encrypting, last when decrypting
+u64 Crypter::mgm(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, bool encrypt)
+{
+	u32 K[8];
+	loadMagmaKey(K, key);
+
+	u64 icn = loadBlock(nonce, 8) & 0x7FFFFFFFFFFFFFFFULL;
+	u32 A[2] = { static_cast<u32>(icn), static_cast<u32>(icn) };
+	u32 B[2] = { static_cast<u32>(icn >> 32), static_cast<u32>(icn >> 32) | 0x80000000 };
+
+	cryptBlocks(A, B, 2, K, magmaSBox.S);
+
+	const u64 y = static_cast<u64>(B[0]) << 32 | A[0];
+	const u64 z = static_cast<u64>(B[1]) << 32 | A[1];
+
+	const size_t adBlocks = (adSize + 7) / 8;
+	const size_t adItems = (adSize + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+	const size_t dataItems = (size + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+
+	std::vector<u64> sums(adItems + dataItems);
+
+	parallelFor(adItems + dataItems, [&](size_t i) {
+		if (i < adItems) {
+			const size_t offset = i * PARALLEL_CHUNK;
+			sums[i] = mgmSum(ad + offset, std::min(PARALLEL_CHUNK, adSize - offset), K, z + (static_cast<u64>(offset / 8) << 32));
+			return;
+		}
+
+		const size_t offset = (i - adItems) * PARALLEL_CHUNK;
+		const size_t length = std::min(PARALLEL_CHUNK, size - offset);
+		const u64 first = (y & 0xFFFFFFFF00000000ULL) | ((y + offset / 8) & 0xFFFFFFFF);
+
+		if (encrypt) {
+			cryptCtrRange(src + offset, dst + offset, length, K, first, 0xFFFFFFFF);
+		}
+
+		sums[i] = mgmSum((encrypt ? dst : src) + offset, length, K, z + (static_cast<u64>(adBlocks + offset / 8) << 32));
+
+		if (!encrypt) {
+			cryptCtrRange(src + offset, dst + offset, length, K, first, 0xFFFFFFFF);
+		}
+	});
+
+	u64 sum = 0;
+	for (u64 part : sums) {
+		sum ^= part;
+	}
+
+	// the last H multiplies len(A) || len(C) in bits
+	u64 lengths[1] = { static_cast<u64>(adSize) * 8 << 32 | (static_cast<u64>(size) * 8 & 0xFFFFFFFF) };
+	u64 last[1] = { 0 };
+	A[0] = static_cast<u32>(z);
+	B[0] = static_cast<u32>((z >> 32) + adBlocks + (size + 7) / 8);
+	cryptBlocks(A, B, 1, K, magmaSBox.S);
+	last[0] = static_cast<u64>(B[0]) << 32 | A[0];
+	sum ^= gfMulSum(last, lengths, 1);
+
+	A[0] = static_cast<u32>(sum);
+	B[0] = static_cast<u32>(sum >> 32);
+	cryptBlocks(A, B, 1, K, magmaSBox.S);
+
+	memwipe(K, 32);
+
+	return static_cast<u64>(B[0]) << 32 | A[0];
+}
+
+// len(A) and len(C) take 32 bits each in the last block, and A || C is counted in blocks by the
+// 32-bit half of Z
+static bool mgmSizesFit(size_t size, size_t adSize)
+{
+	return adSize <= MGM_MAX_SIZE && size <= MGM_MAX_SIZE - adSize;
+}
+
+bool Crypter::mgmEncrypt(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, byte* tag)
+{
+	if (!mgmSizesFit(size, adSize)) {
+		return false;
+	}
+
+	const u64 t = mgm(src, dst, size, ad, adSize, key, nonce, true);
+
+	for (u8 i = 0; i < 8; ++i) {
+		tag[i] = static_cast<byte>(t >> (56 - i * 8));
+	}
+
+	return true;
+}
+
+bool Crypter::mgmDecrypt(const byte* src, byte* dst, size_t size, const byte* ad, size_t adSize, const byte* key, const byte* nonce, const byte* tag)
+{
+	if (!mgmSizesFit(size, adSize)) {
+		return false;
+	}
+
+	const u64 diff = mgm(src, dst, size, ad, adSize, key, nonce, false) ^ loadBlock(tag, 8);
+
+	if (diff != 0) {
+		memwipe(dst, size);
+		return false;
+	}
+
+	return true;
+}
+
+constexpr size_t PIPELINE_CHUNK = 16 * 1024; // small enough to still be in L1/L2 when the other stage gets to it
+constexpr size_t PIPELINE_LEAD = 4;           // chunks the hashing thread may run ahead of the crypting one
+constexpr size_t PIPELINE_MIN_PARALLEL = 256 * 1024;
+
+void Crypter::cryptDataAndHash(const byte* src, byte* dst, size_t size, const byte* password, byte* hash)
+{
+	memcpy(X, password, 32);
+
+	u32 N3 = Sync[0];
+	u32 N4 = Sync[1];
 
 	cryptBlock(N3, N4);
 
-	int rem = static_cast<int>(size);
+	// Hasher walks the message tail first, so the chunks are counted from the end.
+	// The last one is the head of the message, 1..PIPELINE_CHUNK bytes long.
+	const size_t tailChunks = size ? (size - 1) / PIPELINE_CHUNK : 0;
+	const size_t headSize = size - tailChunks * PIPELINE_CHUNK;
 
-	while (rem > 0) {
-		N2 = N4 = addMod32_1(N4, C1);
-		N1 = N3 = N3 + C2;
+	Hasher hasher;
+
+	const auto hashChunk = [&](size_t i) {
+		if (i < tailChunks) {
+			hasher.updateTail(src + size - (i + 1) * PIPELINE_CHUNK, PIPELINE_CHUNK);
+		}
+		else {
+			hasher.finalHead(src, headSize, hash);
+		}
+	};
+
+	const auto cryptChunk = [&](size_t i) {
+		const size_t offset = i < tailChunks ? size - (i + 1) * PIPELINE_CHUNK : 0;
+		cryptGamma(src + offset, dst + offset, i < tailChunks ? PIPELINE_CHUNK : headSize, N3, N4, offset);
+	};
+
+	if (size < PIPELINE_MIN_PARALLEL || std::thread::hardware_concurrency() < 2) {
+		for (size_t i = 0; i <= tailChunks; ++i) {
+			hashChunk(i);
+			cryptChunk(i);
+		}
+	}
+	else {
+		// A chunk is crypted only after it was hashed, so src may be dst,
+		// and the hashing thread does not run too far ahead, so the chunk is still cached
+		std::atomic<size_t> hashed = 0;
+		std::atomic<size_t> crypted = 0;
+
+		const auto waitFor = [](std::atomic<size_t>& counter, size_t value) {
+			for (size_t c = counter.load(std::memory_order_acquire); c < value; c = counter.load(std::memory_order_acquire)) {
+				counter.wait(c, std::memory_order_acquire);
+			}
+		};
+
+		std::thread hashing([&] {
+			for (size_t i = 0; i <= tailChunks; ++i) {
+				if (i >= PIPELINE_LEAD) {
+					waitFor(crypted, i - PIPELINE_LEAD + 1);
+				}
+				hashChunk(i);
+				hashed.store(i + 1, std::memory_order_release);
+				hashed.notify_one();
+			}
+		});
+
+		for (size_t i = 0; i <= tailChunks; ++i) {
+			waitFor(hashed, i + 1);
+			cryptChunk(i);
+			crypted.store(i + 1, std::memory_order_release);
+			crypted.notify_one();
+		}
+
+		hashing.join();
+	}
 
-		cryptBlock(N1, N2);
+	memwipe(X, 32);
+}
 
-		memcpy(&AB, src, 8);
+// N3, N4 is the encrypted sync, offset is the position of src in the message
+void Crypter::cryptGamma(const byte* src, byte* dst, size_t size, u32 N3, u32 N4, size_t offset)
+{
+	GammaCounter counter{ N3, N4 };
+	counter.seek(offset / 8);
 
-		A ^= N1;
-		B ^= N2;
+	xorGamma(src, dst, size, offset, [&](u32* N1, u32* N2, size_t n) {
+		for (size_t j = 0; j < n; ++j) {
+			counter.next(N1[j], N2[j]);
+		}
 
-		memcpy(dst, &AB, std::min(8, rem));
+		cryptBlocks(N1, N2, n, X, SBox);
+	});
+}
 
-		src += 8;
-		dst += 8;
-		rem -= 8;
+void Crypter::recryptData(byte* data, size_t size, const byte* oldPassword, const byte* newPassword)
+{
+	if (size == 0) {
+		return;
 	}
 
+	Crypter old(*this);
+
+	memcpy(old.X, oldPassword, 32);
+	memcpy(X, newPassword, 32);
+
+	u32 oldN3 = Sync[0];
+	u32 oldN4 = Sync[1];
+	u32 N3 = Sync[0];
+	u32 N4 = Sync[1];
+
+	old.cryptBlock(oldN3, oldN4);
+	cryptBlock(N3, N4);
+
+	// C' = C ^ G_old ^ G_new, both gammas are computed side by side and applied at once
+	parallelFor((size + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK, [&](size_t i) {
+		const size_t offset = i * PARALLEL_CHUNK;
+
+		GammaCounter oldCounter{ oldN3, oldN4 };
+		GammaCounter counter{ N3, N4 };
+		oldCounter.seek(offset / 8);
+		counter.seek(offset / 8);
+
+		xorGamma(data + offset, data + offset, std::min(PARALLEL_CHUNK, size - offset), offset, [&](u32* G1, u32* G2, size_t n) {
+			u32 N1[GAMMA_BATCH];
+			u32 N2[GAMMA_BATCH];
+
+			for (size_t j = 0; j < n; ++j) {
+				oldCounter.next(N1[j], N2[j]);
+				counter.next(G1[j], G2[j]);
+			}
+
+			old.cryptBlocks(N1, N2, n, old.X, old.SBox);
+			cryptBlocks(G1, G2, n, X, SBox);
+
+			for (size_t j = 0; j < n; ++j) {
+				G1[j] ^= N1[j];
+				G2[j] ^= N2[j];
+			}
+		});
+	});
+
+	memwipe(old.X, 32);
 	memwipe(X, 32);
 }
 
 
+static inline u32 substitute(const u32 (*table)[256], u32 word)
+{
+	return table[3][word >> 24] ^
+		table[2][static_cast<u8>(word >> 16)] ^
+		table[1][static_cast<u8>(word >> 8)] ^
+		table[0][static_cast<u8>(word)];
+}
+
 u32 Crypter::f(u32 word)
 {
-	return SBox[3][word >> 24] ^
-		SBox[2][static_cast<u8>(word >> 16)] ^
-		SBox[1][static_cast<u8>(word >> 8)] ^
-		SBox[0][static_cast<u8>(word)];
+	return substitute(SBox, word);
 }
 
 static constexpr u8 cryptRounds[32] =
@@ -284,6 +831,17 @@ static constexpr u8 cryptRounds[32] =
 	7,6,5,4,3,2,1,0
 };
 
+static constexpr u8 decryptRounds[32] =
+{
+	0,1,2,3,4,5,6,7,
+	7,6,5,4,3,2,1,0,
+	7,6,5,4,3,2,1,0,
+	7,6,5,4,3,2,1,0
+};
+
+// the MAC cycle is the first 16 rounds of encryption, without the final swap
+constexpr u8 MAC_ROUNDS = 16;
+
 void Crypter::cryptBlock(u32& A, u32& B)
 {
 	for (u8 i = 0; i < 31; i += 2) {
@@ -294,4 +852,351 @@ void Crypter::cryptBlock(u32& A, u32& B)
 	std::swap(B, A);
 }
 
+#ifdef GOST_X86
+GOST_TARGET("avx2")
+static inline __m256i fAvx2(const u32 (*SBox)[256], __m256i word)
+{
+	const __m256i mask = _mm256_set1_epi32(0xFF);
+
+	__m256i r = _mm256_i32gather_epi32(reinterpret_cast<const int*>(SBox[0]), _mm256_and_si256(word, mask), 4);
+	r = _mm256_xor_si256(r, _mm256_i32gather_epi32(reinterpret_cast<const int*>(SBox[1]), _mm256_and_si256(_mm256_srli_epi32(word, 8), mask), 4));
+	r = _mm256_xor_si256(r, _mm256_i32gather_epi32(reinterpret_cast<const int*>(SBox[2]), _mm256_and_si256(_mm256_srli_epi32(word, 16), mask), 4));
+	return _mm256_xor_si256(r, _mm256_i32gather_epi32(reinterpret_cast<const int*>(SBox[3]), _mm256_srli_epi32(word, 24), 4));
+}
+
+// cryptBlock() for 8 blocks, one per 32-bit lane
+GOST_TARGET("avx2")
+static void cryptBlocksAvx2(const u32 (*SBox)[256], const u32* X, u32* A, u32* B)
+{
+	__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A));
+	__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(B));
+
+	for (u8 i = 0; i < 31; i += 2) {
+		b = _mm256_xor_si256(b, fAvx2(SBox, _mm256_add_epi32(a, _mm256_set1_epi32(X[cryptRounds[i]]))));
+		a = _mm256_xor_si256(a, fAvx2(SBox, _mm256_add_epi32(b, _mm256_set1_epi32(X[cryptRounds[i + 1]]))));
+	}
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(A), b);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(B), a);
+}
+
+GOST_TARGET("avx512f")
+static inline __m512i fAvx512(const u32 (*SBox)[256], __m512i word)
+{
+	const __m512i mask = _mm512_set1_epi32(0xFF);
+
+	__m512i r = _mm512_i32gather_epi32(_mm512_and_si512(word, mask), SBox[0], 4);
+	r = _mm512_xor_si512(r, _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(word, 8), mask), SBox[1], 4));
+	r = _mm512_xor_si512(r, _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(word, 16), mask), SBox[2], 4));
+	return _mm512_xor_si512(r, _mm512_i32gather_epi32(_mm512_srli_epi32(word, 24), SBox[3], 4));
+}
+
+// cryptBlock() for 16 blocks, one per 32-bit lane
+GOST_TARGET("avx512f")
+static void cryptBlocksAvx512(const u32 (*SBox)[256], const u32* X, u32* A, u32* B)
+{
+	__m512i a = _mm512_loadu_si512(A);
+	__m512i b = _mm512_loadu_si512(B);
+
+	for (u8 i = 0; i < 31; i += 2) {
+		b = _mm512_xor_si512(b, fAvx512(SBox, _mm512_add_epi32(a, _mm512_set1_epi32(X[cryptRounds[i]]))));
+		a = _mm512_xor_si512(a, fAvx512(SBox, _mm512_add_epi32(b, _mm512_set1_epi32(X[cryptRounds[i + 1]]))));
+	}
+
+	_mm512_storeu_si512(A, b);
+	_mm512_storeu_si512(B, a);
+}
+#endif
+
+// cryptBlock() under `key` and `table` for n independent blocks, interleaved on the widest path the CPU has
+void Crypter::cryptBlocks(u32* A, u32* B, size_t n, const u32* key, const u32 (*table)[256])
+{
+	size_t i = 0;
+
+#ifdef GOST_X86
+	if (cpu::hasAvx512()) {
+		for (; i + 16 <= n; i += 16) {
+			cryptBlocksAvx512(table, key, A + i, B + i);
+		}
+	}
+
+	if (cpu::hasAvx2()) {
+		for (; i + 8 <= n; i += 8) {
+			cryptBlocksAvx2(table, key, A + i, B + i);
+		}
+	}
+#endif
+
+	for (; i + 4 <= n; i += 4) {
+		u32 a[4] = { A[i], A[i + 1], A[i + 2], A[i + 3] };
+		u32 b[4] = { B[i], B[i + 1], B[i + 2], B[i + 3] };
+
+		for (u8 r = 0; r < 31; r += 2) {
+			for (u8 k = 0; k < 4; ++k) {
+				b[k] ^= substitute(table, a[k] + key[cryptRounds[r]]);
+			}
+			for (u8 k = 0; k < 4; ++k) {
+				a[k] ^= substitute(table, b[k] + key[cryptRounds[r + 1]]);
+			}
+		}
+
+		for (u8 k = 0; k < 4; ++k) {
+			A[i + k] = b[k];
+			B[i + k] = a[k];
+		}
+	}
+
+	for (; i < n; ++i) {
+		u32 a = A[i];
+		u32 b = B[i];
+
+		for (u8 r = 0; r < 31; r += 2) {
+			b ^= substitute(table, a + key[cryptRounds[r]]);
+			a ^= substitute(table, b + key[cryptRounds[r + 1]]);
+		}
+
+		A[i] = b;
+		B[i] = a;
+	}
+}
+
+#ifdef GOST_X86
+// cryptBlocksKeyed() for 8 blocks, one per 32-bit lane, each with its own key
+GOST_TARGET("avx2")
+static void cryptBlocksKeyedAvx2(const u32 (*SBox)[256], const u32* const* keys, const u8* rounds, u8 count, u32* A, u32* B)
+{
+	__m256i K[8];
+	for (u8 w = 0; w < 8; ++w) {
+		K[w] = _mm256_setr_epi32(
+			static_cast<int>(keys[0][w]), static_cast<int>(keys[1][w]), static_cast<int>(keys[2][w]), static_cast<int>(keys[3][w]),
+			static_cast<int>(keys[4][w]), static_cast<int>(keys[5][w]), static_cast<int>(keys[6][w]), static_cast<int>(keys[7][w]));
+	}
+
+	__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(A));
+	__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(B));
+
+	for (u8 i = 0; i < count; i += 2) {
+		b = _mm256_xor_si256(b, fAvx2(SBox, _mm256_add_epi32(a, K[rounds[i]])));
+		a = _mm256_xor_si256(a, fAvx2(SBox, _mm256_add_epi32(b, K[rounds[i + 1]])));
+	}
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(A), count == MAC_ROUNDS ? a : b);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(B), count == MAC_ROUNDS ? b : a);
+
+	memwipe(K, sizeof(K));
+}
+#endif
+
+// Blocks under keys of their own, keys[i] for block i. rounds is one of the round tables,
+// count is 32 for the ciphering cycles and MAC_ROUNDS for the MAC one, which ends without the swap
+void Crypter::cryptBlocksKeyed(u32* A, u32* B, size_t n, const u32* const* keys, const u8* rounds, u8 count)
+{
+	size_t i = 0;
+
+#ifdef GOST_X86
+	if (cpu::hasAvx2()) {
+		for (; i + 8 <= n; i += 8) {
+			cryptBlocksKeyedAvx2(SBox, keys + i, rounds, count, A + i, B + i);
+		}
+	}
+#endif
+
+	for (; i < n; ++i) {
+		u32 a = A[i];
+		u32 b = B[i];
+
+		for (u8 r = 0; r < count; r += 2) {
+			b ^= f(a + keys[i][rounds[r]]);
+			a ^= f(b + keys[i][rounds[r + 1]]);
+		}
+
+		A[i] = count == MAC_ROUNDS ? a : b;
+		B[i] = count == MAC_ROUNDS ? b : a;
+	}
+}
+
+constexpr size_t WRAP_BATCH = 256; // keys a worker wraps at once, lane by lane
+
+static inline u32 loadWord(const byte* src) {
+	u32 word;
+	memcpy(&word, src, 4);
+	return word;
+}
+
+// RFC 4357 6.5 CryptoPro KEK diversification: every keks[i] becomes KEK(UKM) for its own ukms[i]
+void Crypter::diversifyKeys(u32 (*keks)[8], const UkmBytes* ukms, size_t n)
+{
+	std::vector<const u32*> keys(n);
+	Secured<std::vector<std::array<u32, 8>>> old{ std::vector<std::array<u32, 8>>(n) };
+	std::vector<u32> A(n);
+	std::vector<u32> B(n);
+
+	for (size_t i = 0; i < n; ++i) {
+		keys[i] = old[i].data();
+	}
+
+	for (u8 step = 0; step < 8; ++step) {
+		for (size_t i = 0; i < n; ++i) {
+			memcpy(old[i].data(), keks[i], 32);
+
+			u32 S1 = 0;
+			u32 S2 = 0;
+			for (u8 j = 0; j < 8; ++j) {
+				(((ukms[i][step] >> j) & 1) ? S1 : S2) += keks[i][j];
+			}
+
+			A[i] = S1;
+			B[i] = S2;
+		}
+
+		// the key is CFB-encrypted under itself, the sums are the iv
+		for (u8 j = 0; j < 8; j += 2) {
+			cryptBlocksKeyed(A.data(), B.data(), n, keys.data(), cryptRounds, 32);
+
+			for (size_t i = 0; i < n; ++i) {
+				A[i] = keks[i][j] ^= A[i];
+				B[i] = keks[i][j + 1] ^= B[i];
+			}
+		}
+	}
+
+	memwipe(A.data(), n * 4);
+	memwipe(B.data(), n * 4);
+}
+
+void Crypter::wrapKeys(const MasterKeyBytes* keys, const byte* kek, const UkmBytes* ukms, WrappedKey* wrapped, size_t n)
+{
+	parallelFor((n + WRAP_BATCH - 1) / WRAP_BATCH, [&](size_t batch) {
+		const size_t first = batch * WRAP_BATCH;
+		const size_t lanes = std::min(WRAP_BATCH, n - first);
+
+		u32 keks[WRAP_BATCH][8];
+		const u32* schedules[WRAP_BATCH * 4] = {};
+		u32 A[WRAP_BATCH * 4];
+		u32 B[WRAP_BATCH * 4];
+
+		for (size_t i = 0; i < lanes; ++i) {
+			memcpy(keks[i], kek, 32);
+		}
+		diversifyKeys(keks, ukms + first, lanes);
+
+		// CEK_ENC: simple replacement of the four blocks of every key
+		for (size_t i = 0; i < lanes * 4; ++i) {
+			const byte* cek = reinterpret_cast<const byte*>(keys[first + i / 4].data()) + i % 4 * 8;
+			A[i] = loadWord(cek);
+			B[i] = loadWord(cek + 4);
+			schedules[i] = keks[i / 4];
+		}
+
+		cryptBlocksKeyed(A, B, lanes * 4, schedules, cryptRounds, 32);
+
+		for (size_t i = 0; i < lanes * 4; ++i) {
+			byte* out = wrapped[first + i / 4].data() + SIZE_OF_UKM + i % 4 * 8;
+			memcpy(out, &A[i], 4);
+			memcpy(out + 4, &B[i], 4);
+		}
+
+		// CEK_MAC: MAC of the key with the ukm as iv
+		for (size_t i = 0; i < lanes; ++i) {
+			A[i] = loadWord(ukms[first + i].data());
+			B[i] = loadWord(ukms[first + i].data() + 4);
+			schedules[i] = keks[i];
+		}
+
+		for (u8 block = 0; block < 4; ++block) {
+			for (size_t i = 0; i < lanes; ++i) {
+				const byte* cek = reinterpret_cast<const byte*>(keys[first + i].data()) + block * 8;
+				A[i] ^= loadWord(cek);
+				B[i] ^= loadWord(cek + 4);
+			}
+
+			cryptBlocksKeyed(A, B, lanes, schedules, cryptRounds, MAC_ROUNDS);
+		}
+
+		for (size_t i = 0; i < lanes; ++i) {
+			memcpy(wrapped[first + i].data(), ukms[first + i].data(), SIZE_OF_UKM);
+			memcpy(wrapped[first + i].data() + SIZE_OF_UKM + SIZE_OF_KEY, &A[i], 4);
+		}
+
+		memwipe(keks, sizeof(keks));
+		memwipe(A, sizeof(A));
+		memwipe(B, sizeof(B));
+	});
+}
+
+void Crypter::unwrapKeys(const WrappedKey* wrapped, const byte* kek, MasterKeyBytes* keys, bool* ok, size_t n)
+{
+	parallelFor((n + WRAP_BATCH - 1) / WRAP_BATCH, [&](size_t batch) {
+		const size_t first = batch * WRAP_BATCH;
+		const size_t lanes = std::min(WRAP_BATCH, n - first);
+
+		u32 keks[WRAP_BATCH][8];
+		UkmBytes ukms[WRAP_BATCH];
+		const u32* schedules[WRAP_BATCH * 4] = {};
+		u32 A[WRAP_BATCH * 4];
+		u32 B[WRAP_BATCH * 4];
+
+		for (size_t i = 0; i < lanes; ++i) {
+			memcpy(keks[i], kek, 32);
+			memcpy(ukms[i].data(), wrapped[first + i].data(), SIZE_OF_UKM);
+		}
+		diversifyKeys(keks, ukms, lanes);
+
+		// the key is decrypted straight into its secured storage
+		for (size_t i = 0; i < lanes * 4; ++i) {
+			const byte* enc = wrapped[first + i / 4].data() + SIZE_OF_UKM + i % 4 * 8;
+			A[i] = loadWord(enc);
+			B[i] = loadWord(enc + 4);
+			schedules[i] = keks[i / 4];
+		}
+
+		cryptBlocksKeyed(A, B, lanes * 4, schedules, decryptRounds, 32);
+
+		for (size_t i = 0; i < lanes * 4; ++i) {
+			byte* cek = reinterpret_cast<byte*>(keys[first + i / 4].data()) + i % 4 * 8;
+			memcpy(cek, &A[i], 4);
+			memcpy(cek + 4, &B[i], 4);
+		}
+
+		for (size_t i = 0; i < lanes; ++i) {
+			A[i] = loadWord(ukms[i].data());
+			B[i] = loadWord(ukms[i].data() + 4);
+			schedules[i] = keks[i];
+		}
+
+		for (u8 block = 0; block < 4; ++block) {
+			for (size_t i = 0; i < lanes; ++i) {
+				const byte* cek = reinterpret_cast<const byte*>(keys[first + i].data()) + block * 8;
+				A[i] ^= loadWord(cek);
+				B[i] ^= loadWord(cek + 4);
+			}
+
+			cryptBlocksKeyed(A, B, lanes, schedules, cryptRounds, MAC_ROUNDS);
+		}
+
+		for (size_t i = 0; i < lanes; ++i) {
+			ok[first + i] = A[i] == loadWord(wrapped[first + i].data() + SIZE_OF_UKM + SIZE_OF_KEY);
+			if (!ok[first + i]) {
+				memwipe(keys[first + i].data(), SIZE_OF_KEY);
+			}
+		}
+
+		memwipe(keks, sizeof(keks));
+		memwipe(A, sizeof(A));
+		memwipe(B, sizeof(B));
+	});
+}
+
+void Crypter::wrapKey(const MasterKeyBytes& key, const byte* kek, const UkmBytes& ukm, WrappedKey& wrapped)
+{
+	wrapKeys(&key, kek, &ukm, &wrapped, 1);
+}
+
+bool Crypter::unwrapKey(const WrappedKey& wrapped, const byte* kek, MasterKeyBytes& key)
+{
+	bool ok;
+	unwrapKeys(&wrapped, kek, &key, &ok, 1);
+	return ok;
+}
+
 } // namespace gost
@@ -1,931 +1,1102 @@
 #include "hash.h"
+#include "cpu.h"
+#include "parallel.h"
+#include "bytes.h"
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 namespace gost
 {
 
-// Tables for function F
-static const u64 T[8][256]{
-{
-	0xE6F87E5C5B711FD0ULL,0x258377800924FA16ULL,0xC849E07E852EA4A8ULL,0x5B4686A18F06C16AULL,
-	0x0B32E9A2D77B416EULL,0xABDA37A467815C66ULL,0xF61796A81A686676ULL,0xF5DC0B706391954BULL,
-	0x4862F38DB7E64BF1ULL,0xFF5C629A68BD85C5ULL,0xCB827DA6FCD75795ULL,0x66D36DAF69B9F089ULL,
-	0x356C9F74483D83B0ULL,0x7CBCECB1238C99A1ULL,0x36A702AC31C4708DULL,0x9EB6A8D02FBCDFD6ULL,
-	0x8B19FA51E5B3AE37ULL,0x9CCFB5408A127D0BULL,0xBC0C78B508208F5AULL,0xE533E3842288ECEDULL,
-	0xCEC2C7D377C15FD2ULL,0xEC7817B6505D0F5EULL,0xB94CC2C08336871DULL,0x8C205DB4CB0B04ADULL,
-	0x763C855B28A0892FULL,0x588D1B79F6FF3257ULL,0x3FECF69E4311933EULL,0x0FC0D39F803A18C9ULL,
-	0xEE010A26F5F3AD83ULL,0x10EFE8F4411979A6ULL,0x5DCDA10C7DE93A10ULL,0x4A1BEE1D1248E92CULL,
-	0x53BFF2DB21847339ULL,0xB4F50CCFA6A23D09ULL,0x5FB4BC9CD84798CDULL,0xE88A2D8B071C56F9ULL,
-	0x7F7771695A756A9CULL,0xC5F02E71A0BA1EBCULL,0xA663F9AB4215E672ULL,0x2EB19E22DE5FBB78ULL,
-	0x0DB9CE0F2594BA14ULL,0x82520E6397664D84ULL,0x2F031E6A0208EA98ULL,0x5C7F2144A1BE6BF0ULL,
-	0x7A37CB1CD16362DBULL,0x83E08E2B4B311C64ULL,0xCF70479BAB960E32ULL,0x856BA986B9DEE71EULL,
-	0xB5478C877AF56CE9ULL,0xB8FE42885F61D6FDULL,0x1BDD0156966238C8ULL,0x622157923EF8A92EULL,
-	0xFC97FF42114476F8ULL,0x9D7D350856452CEBULL,0x4C90C9B0E0A71256ULL,0x2308502DFBCB016CULL,
-	0x2D7A03FAA7A64845ULL,0xF46E8B38BFC6C4ABULL,0xBDBEF8FDD477DEBAULL,0x3AAC4CEBC8079B79ULL,
-	0xF09CB105E8879D0CULL,0x27FA6A10AC8A58CBULL,0x8960E7C1401D0CEAULL,0x1A6F811E4A356928ULL,
-	0x90C4FB0773D196FFULL,0x43501A2F609D0A9FULL,0xF7A516E0C63F3796ULL,0x1CE4A6B3B8DA9252ULL,
-	0x1324752C38E08A9BULL,0xA5A864733BEC154FULL,0x2BF124575549B33FULL,0xD766DB15440DC5C7ULL,
-	0xA7D179E39E42B792ULL,0xDADF151A61997FD3ULL,0x86A0345EC0271423ULL,0x38D5517B6DA939A4ULL,
-	0x6518F077104003B4ULL,0x02791D90A5AEA2DDULL,0x88D267899C4A5D0AULL,0x930F66DF0A2865C2ULL,
-	0x4EE9D4204509B08BULL,0x325538916685292AULL,0x412907BFC533A842ULL,0xB27E2B62544DC673ULL,
-	0x6C5304456295E007ULL,0x5AF406E95351908AULL,0x1F2F3B6BC123616FULL,0xC37B09DC5255E5C6ULL,
-	0x3967D133B1FE6844ULL,0x298839C7F0E711E2ULL,0x409B87F71964F9A2ULL,0xE938ADC3DB4B0719ULL,
-	0x0C0B4E47F9C3EBF4ULL,0x5534D576D36B8843ULL,0x4610A05AEB8B02D8ULL,0x20C3CDF58232F251ULL,
-	0x6DE1840DBEC2B1E7ULL,0xA0E8DE06B0FA1D08ULL,0x7B854B540D34333BULL,0x42E29A67BCCA5B7FULL,
-	0xD8A6088AC437DD0EULL,0xC63BB3A9D943ED81ULL,0x21714DBD5E65A3B1ULL,0x6761EDE7B5EEA169ULL,
-	0x2431F7C8D573ABF6ULL,0xD51FC685E1A3671AULL,0x5E063CD40410C92DULL,0x283AB98F2CB04002ULL,
-	0x8FEBC06CB2F2F790ULL,0x17D64F116FA1D33CULL,0xE07359F1A99EE4AAULL,0x784ED68C74CDC006ULL,
-	0x6E2A19D5C73B42DAULL,0x8712B4161C7045C3ULL,0x371582E4ED93216DULL,0xACE390414939F6FCULL,
-	0x7EC5F12186223B7CULL,0xC0B094042BAC16FBULL,0xF9D745379A527EBFULL,0x737C3F2EA3B68168ULL,
-	0x33E7B8D9BAD278CAULL,0xA9A32A34C22FFEBBULL,0xE48163CCFEDFBD0DULL,0x8E5940246EA5A670ULL,
-	0x51C6EF4B842AD1E4ULL,0x22BAD065279C508CULL,0xD91488C218608CEEULL,0x319EA5491F7CDA17ULL,
-	0xD394E128134C9C60ULL,0x094BF43272D5E3B3ULL,0x9BF612A5A4AAD791ULL,0xCCBBDA43D26FFD0FULL,
-	0x34DE1F3C946AD250ULL,0x4F5B5468995EE16BULL,0xDF9FAF6FEA8F7794ULL,0x2648EA5870DD092BULL,
-	0xBFC7E56D71D97C67ULL,0xDDE6B2FF4F21D549ULL,0x3C276B463AE86003ULL,0x91767B4FAF86C71FULL,
-	0x68A13E7835D4B9A0ULL,0xB68C115F030C9FD4ULL,0x141DD2C916582001ULL,0x983D8F7DDD5324ACULL,
-	0x64AA703FCC175254ULL,0xC2C989948E02B426ULL,0x3E5E76D69F46C2DEULL,0x50746F03587D8004ULL,
-	0x45DB3D829272F1E5ULL,0x60584A029B560BF3ULL,0xFBAE58A73FFCDC62ULL,0xA15A5E4E6CAD4CE8ULL,
-	0x4BA96E55CE1FB8CCULL,0x08F9747AAE82B253ULL,0xC102144CF7FB471BULL,0x9F042898F3EB8E36ULL,
-	0x068B27ADF2EFFB7AULL,0xEDCA97FE8C0A5EBEULL,0x778E0513F4F7D8CFULL,0x302C2501C32B8BF7ULL,
-	0x8D92DDFC175C554DULL,0xF865C57F46052F5FULL,0xEAF3301BA2B2F424ULL,0xAA68B7ECBBD60D86ULL,
-	0x998F0F350104754CULL,0x0000000000000000ULL,0xF12E314D34D0CCECULL,0x710522BE061823B5ULL,
-	0xAF280D9930C005C1ULL,0x97FD5CE25D693C65ULL,0x19A41CC633CC9A15ULL,0x95844172F8C79EB8ULL,
-	0xDC5432B7937684A9ULL,0x9436C13A2490CF58ULL,0x802B13F332C8EF59ULL,0xC442AE397CED4F5CULL,
-	0xFA1CD8EFE3AB8D82ULL,0xF2E5AC954D293FD1ULL,0x6AD823E8907A1B7DULL,0x4D2249F83CF043B6ULL,
-	0x03CB9DD879F9F33DULL,0xDE2D2F2736D82674ULL,0x2A43A41F891EE2DFULL,0x6F98999D1B6C133AULL,
-	0xD4AD46CD3DF436FAULL,0xBB35DF50269825C0ULL,0x964FDCAA813E6D85ULL,0xEB41B0537EE5A5C4ULL,
-	0x0540BA758B160847ULL,0xA41AE43BE7BB44AFULL,0xE3B8C429D0671797ULL,0x819993BBEE9FBEB9ULL,
-	0xAE9A8DD1EC975421ULL,0xF3572CDD917E6E31ULL,0x6393D7DAE2AFF8CEULL,0x47A2201237DC5338ULL,
-	0xA32343DEC903EE35ULL,0x79FC56C4A89A91E6ULL,0x01B28048DC5751E0ULL,0x1296F564E4B7DB7BULL,
-	0x75F7188351597A12ULL,0xDB6D9552BDCE2E33ULL,0x1E9DBB231D74308FULL,0x520D7293FDD322D9ULL,
-	0xE20A44610C304677ULL,0xFEEEE2D2B4EAD425ULL,0xCA30FDEE20800675ULL,0x61EACA4A47015A13ULL,
-	0xE74AFE1487264E30ULL,0x2CC883B27BF119A5ULL,0x1664CF59B3F682DCULL,0xA811AA7C1E78AF5BULL,
-	0x1D5626FB648DC3B2ULL,0xB73E9117DF5BCE34ULL,0xD05F7CF06AB56F5DULL,0xFD257F0ACD132718ULL,
-	0x574DC8E676C52A9EULL,0x0739A7E52EB8AA9AULL,0x5486553E0F3CD9A3ULL,0x56FF48AEAA927B7EULL,
-	0xBE756525AD8E2D87ULL,0x7D0E6CF9FFDBC841ULL,0x3B1ECCA31450CA99ULL,0x6913BE30E983E840ULL,
-	0xAD511009956EA71CULL,0xB1B5B6BA2DB4354EULL,0x4469BDCA4E25A005ULL,0x15AF5281CA0F71E1ULL,
-	0x744598CB8D0E2BF2ULL,0x593F9B312AA863B7ULL,0xEFB38A6E29A4FC63ULL,0x6B6AA3A04C2D4A9DULL,
-	0x3D95EB0EE6BF31E3ULL,0xA291C3961554BFD5ULL,0x18169C8EEF9BCBF5ULL,0x115D68BC9D4E2846ULL,
-	0xBA875F18FACF7420ULL,0xD1EDFCB8B6E23EBDULL,0xB00736F2F1E364AEULL,0x84D929CE6589B6FEULL,
-	0x70B7A2F6DA4F7255ULL,0x0E7253D75C6D4929ULL,0x04F23A3D574159A7ULL,0x0A8069EA0B2C108EULL,
-	0x49D073C56BB11A11ULL,0x8AAB7A1939E4FFD7ULL,0xCD095A0B0E38ACEFULL,0xC9FB60365979F548ULL,
-	0x92BDE697D67F3422ULL,0xC78933E10514BC61ULL,0xE1C1D9B975C9B54AULL,0xD2266160CF1BCD80ULL,
-	0x9A4492ED78FD8671ULL,0xB3CCAB2A881A9793ULL,0x72CEBF667FE1D088ULL,0xD6D45B5D985A9427ULL
-},
-{
-	0xC811A8058C3F55DEULL,0x65F5B43196B50619ULL,0xF74F96B1D6706E43ULL,0x859D1E8BCB43D336ULL,
-	0x5AAB8A85CCFA3D84ULL,0xF9C7BF99C295FCFDULL,0xA21FD5A1DE4B630FULL,0xCDB3EF763B8B456DULL,
-	0x803F59F87CF7C385ULL,0xB27C73BE5F31913CULL,0x98E3AC6633B04821ULL,0xBF61674C26B8F818ULL,
-	0x0FFBC995C4C130C8ULL,0xAAA0862010761A98ULL,0x6057F342210116AAULL,0xF63C760C0654CC35ULL,
-	0x2DDB45CC667D9042ULL,0xBCF45A964BD40382ULL,0x68E8A0C3EF3C6F3DULL,0xA7BD92D269FF73BCULL,
-	0x290AE20201ED2287ULL,0xB7DE34CDE885818FULL,0xD901EEA7DD61059BULL,0xD6FA273219A03553ULL,
-	0xD56F1AE874CCCEC9ULL,0xEA31245C2E83F554ULL,0x7034555DA07BE499ULL,0xCE26D2AC56E7BEF7ULL,
-	0xFD161857A5054E38ULL,0x6A0E7DA4527436D1ULL,0x5BD86A381CDE9FF2ULL,0xCAF7756231770C32ULL,
-	0xB09AAED9E279C8D0ULL,0x5DEF1091C60674DBULL,0x111046A2515E5045ULL,0x23536CE4729802FCULL,
-	0xC50CBCF7F5B63CFAULL,0x73A16887CD171F03ULL,0x7D2941AFD9F28DBDULL,0x3F5E3EB45A4F3B9DULL,
-	0x84EEFE361B677140ULL,0x3DB8E3D3E7076271ULL,0x1A3A28F9F20FD248ULL,0x7EBC7C75B49E7627ULL,
-	0x74E5F293C7EB565CULL,0x18DCF59E4F478BA4ULL,0x0C6EF44FA9ADCB52ULL,0xC699812D98DAC760ULL,
-	0x788B06DC6E469D0EULL,0xFC65F8EA7521EC4EULL,0x30A5F7219E8E0B55ULL,0x2BEC3F65BCA57B6BULL,
-	0xDDD04969BAF1B75EULL,0x99904CDBE394EA57ULL,0x14B201D1E6EA40F6ULL,0xBBB0C08241284ADDULL,
-	0x50F20463BF8F1DFFULL,0xE8D7F93B93CBACB8ULL,0x4D8CB68E477C86E8ULL,0xC1DD1B3992268E3FULL,
-	0x7C5AA11209D62FCBULL,0x2F3D98ABDB35C9AEULL,0x671369562BFD5FF5ULL,0x15C1E16C36CEE280ULL,
-	0x1D7EB2EDF8F39B17ULL,0xDA94D37DB00DFE01ULL,0x877BC3EC760B8ADAULL,0xCB8495DFE153AE44ULL,
-	0x05A24773B7B410B3ULL,0x12857B783C32ABDFULL,0x8EB770D06812513BULL,0x536739B9D2E3E665ULL,
-	0x584D57E271B26468ULL,0xD789C78FC9849725ULL,0xA935BBFA7D1AE102ULL,0x8B1537A3DFA64188ULL,
-	0xD0CD5D9BC378DE7AULL,0x4AC82C9A4D80CFB7ULL,0x42777F1B83BDB620ULL,0x72D2883A1D33BD75ULL,
-	0x5E7A2D4BAB6A8F41ULL,0xF4DAAB6BBB1C95D9ULL,0x905CFFE7FD8D31B6ULL,0x83AA6422119B381FULL,
-	0xC0AEFB8442022C49ULL,0xA0F908C663033AE3ULL,0xA428AF0804938826ULL,0xADE41C341A8A53C7ULL,
-	0xAE7121EE77E6A85DULL,0xC47F5C4A25929E8CULL,0xB538E9AA55CDD863ULL,0x06377AA9DAD8EB29ULL,
-	0xA18AE87BB3279895ULL,0x6EDFDA6A35E48414ULL,0x6B7D9D19825094A7ULL,0xD41CFA55A4E86CBFULL,
-	0xE5CAEDC9EA42C59CULL,0xA36C351C0E6FC179ULL,0x5181E4DE6FABBF89ULL,0xFFF0C530184D17D4ULL,
-	0x9D41EB1584045892ULL,0x1C0D525028D73961ULL,0xF178EC180CA8856AULL,0x9A0571018EF811CDULL,
-	0x4091A27C3EF5EFCCULL,0x19AF15239F6329D2ULL,0x347450EFF91EB990ULL,0xE11B4A078DD27759ULL,
-	0xB9561DE5FC601331ULL,0x912F1F5A2DA993C0ULL,0x1654DCB65BA2191AULL,0x3E2DDE098A6B99EBULL,
-	0x8A66D71E0F82E3FEULL,0x8C51ADB7D55A08D7ULL,0x4533E50F8941FF7FULL,0x02E6DD67BD4859ECULL,
-	0xE068AABA5DF6D52FULL,0xC24826E3FF4A75A5ULL,0x6C39070D88ACDDF8ULL,0x6486548C4691A46FULL,
-	0xD1BEBD26135C7C0CULL,0xB30F93038F15334AULL,0x82D9849FC1BF9A69ULL,0x9C320BA85420FAE4ULL,
-	0xFA528243AFF90767ULL,0x9ED4D6CFE968A308ULL,0xB825FD582C44B147ULL,0x9B7691BC5EDCB3BBULL,
-	0xC7EA619048FE6516ULL,0x1063A61F817AF233ULL,0x47D538683409A693ULL,0x63C2CE984C6DED30ULL,
-	0x2A9FDFD86C81D91DULL,0x7B1E3B06032A6694ULL,0x666089EBFBD9FD83ULL,0x0A598EE67375207BULL,
-	0x07449A140AFC495FULL,0x2CA8A571B6593234ULL,0x1F986F8A45BBC2FBULL,0x381AA4A050B372C2ULL,
-	0x5423A3ADD81FAF3AULL,0x17273C0B8B86BB6CULL,0xFE83258DC869B5A2ULL,0x287902BFD1C980F1ULL,
-	0xF5A94BD66B3837AFULL,0x88800A79B2CABA12ULL,0x55504310083B0D4CULL,0xDF36940E07B9EEB2ULL,
-	0x04D1A7CE6790B2C5ULL,0x612413FFF125B4DCULL,0x26F12B97C52C124FULL,0x86082351A62F28ACULL,
-	0xEF93632F9937E5E7ULL,0x3507B052293A1BE6ULL,0xE72C30AE570A9C70ULL,0xD3586041AE1425E0ULL,
-	0xDE4574B3D79D4CC4ULL,0x92BA228040C5685AULL,0xF00B0CA5DC8C271CULL,0xBE1287F1F69C5A6EULL,
-	0xF39E317FB1E0DC86ULL,0x495D114020EC342DULL,0x699B407E3F18CD4BULL,0xDCA3A9D46AD51528ULL,
-	0x0D1D14F279896924ULL,0x0000000000000000ULL,0x593EB75FA196C61EULL,0x2E4E78160B116BD8ULL,
-	0x6D4AE7B058887F8EULL,0xE65FD013872E3E06ULL,0x7A6DDBBBD30EC4E2ULL,0xAC97FC89CAAEF1B1ULL,
-	0x09CCB33C1E19DBE1ULL,0x89F3EAC462EE1864ULL,0x7770CF49AA87ADC6ULL,0x56C57ECA6557F6D6ULL,
-	0x03953DDA6D6CFB9AULL,0x36928D884456E07CULL,0x1EEB8F37959F608DULL,0x31D6179C4EAAA923ULL,
-	0x6FAC3AD7E5C02662ULL,0x43049FA653991456ULL,0xABD3669DC052B8EEULL,0xAF02C153A7C20A2BULL,
-	0x3CCB036E3723C007ULL,0x93C9C23D90E1CA2CULL,0xC33BC65E2F6ED7D3ULL,0x4CFF56339758249EULL,
-	0xB1E94E64325D6AA6ULL,0x37E16D359472420AULL,0x79F8E661BE623F78ULL,0x5214D90402C74413ULL,
-	0x482EF1FDF0C8965BULL,0x13F69BC5EC1609A9ULL,0x0E88292814E592BEULL,0x4E198B542A107D72ULL,
-	0xCCC00FCBEBAFE71BULL,0x1B49C844222B703EULL,0x2564164DA840E9D5ULL,0x20C6513E1FF4F966ULL,
-	0xBAC3203F910CE8ABULL,0xF2EDD1C261C47EF0ULL,0x814CB945ACD361F3ULL,0x95FEB8944A392105ULL,
-	0x5C9CF02C1622D6ADULL,0x971865F3F77178E9ULL,0xBD87BA2B9BF0A1F4ULL,0x444005B259655D09ULL,
-	0xED75BE48247FBC0BULL,0x7596122E17CFF42AULL,0xB44B091785E97A15ULL,0x966B854E2755DA9FULL,
-	0xEEE0839249134791ULL,0x32432A4623C652B9ULL,0xA8465B47AD3E4374ULL,0xF8B45F2412B15E8BULL,
-	0x2417F6F078644BA3ULL,0xFB2162FE7FDDA511ULL,0x4BBBCC279DA46DC1ULL,0x0173E0BDD024A276ULL,
-	0x22208C59A2BCA08AULL,0x8FC4906DB836F34DULL,0xE4B90D743A6667EAULL,0x7147B5E0705F46EFULL,
-	0x2782CB2A1508B039ULL,0xEC065EF5F45B1E7DULL,0x21B5B183CFD05B10ULL,0xDBE733C060295C77ULL,
-	0x9FA73672394C017EULL,0xCF55321186C31C81ULL,0xD8720E1A0D45A7EDULL,0x3B8F997A3DDF8958ULL,
-	0x3AFC79C7EDFB2B2EULL,0xE9A4198643EF0ECEULL,0x5F09CDF67B4E2D37ULL,0x4F6A6BE9FA34DF04ULL,
-	0xB6ADD47038A123F9ULL,0x8D224D0A057EAAA1ULL,0xC96248B85C1BF7A8ULL,0xE3FD9760309A2EB5ULL,
-	0x0B2A6E5BA351820DULL,0xEB42C4E1FEA75722ULL,0x948D58299A1D8373ULL,0x7FCF9CC864BAD451ULL,
-	0xA55B4FB5D4B72A50ULL,0x08BF5381CE3D7997ULL,0x46A6D8D5E42D04E5ULL,0xD22B80FC7E308796ULL,
-	0x57B69E77B57354A0ULL,0x3969441D8097D0B4ULL,0x3330CAFBF3E2F0CFULL,0xE28E77DDE0BE8CC3ULL,
-	0x62B12E259C494F46ULL,0xA6CE726FB9DBD1CAULL,0x41E242C1EED14DBAULL,0x76032FF47AA30FB0ULL
-},
-{
-	0x45B268A93ACDE4CCULL,0xAF7F0BE884549D08ULL,0x048354B3C1468263ULL,0x925435C2C80EFED2ULL,
-	0xEE4E37F27FDFFBA7ULL,0x167A33920C60F14DULL,0xFB123B52EA03E584ULL,0x4A0CAB53FDBB9007ULL,
-	0x9DEAF6380F788A19ULL,0xCB48EC558F0CB32AULL,0xB59DC4B2D6FEF7E0ULL,0xDCDBCA22F4F3ECB6ULL,
-	0x11DF5813549A9C40ULL,0xE33FDEDF568ACED3ULL,0xA0C1C8124322E9C3ULL,0x07A56B8158FA6D0DULL,
-	0x77279579B1E1F3DDULL,0xD9B18B74422AC004ULL,0xB8EC2D9FFFABC294ULL,0xF4ACF8A82D75914FULL,
-	0x7BBF69B1EF2B6878ULL,0xC4F62FAF487AC7E1ULL,0x76CE809CC67E5D0CULL,0x6711D88F92E4C14CULL,
-	0x627B99D9243DEDFEULL,0x234AA5C3DFB68B51ULL,0x909B1F15262DBF6DULL,0x4F66EA054B62BCB5ULL,
-	0x1AE2CF5A52AA6AE8ULL,0xBEA053FBD0CE0148ULL,0xED6808C0E66314C9ULL,0x43FE16CD15A82710ULL,
-	0xCD049231A06970F6ULL,0xE7BC8A6C97CC4CB0ULL,0x337CE835FCB3B9C0ULL,0x65DEF2587CC780F3ULL,
-	0x52214EDE4132BB50ULL,0x95F15E4390F493DFULL,0x870839625DD2E0F1ULL,0x41313C1AFB8B66AFULL,
-	0x91720AF051B211BCULL,0x477D427ED4EEA573ULL,0x2E3B4CEEF6E3BE25ULL,0x82627834EB0BCC43ULL,
-	0x9C03E3DD78E724C8ULL,0x2877328AD9867DF9ULL,0x14B51945E243B0F2ULL,0x574B0F88F7EB97E2ULL,
-	0x88B6FA989AA4943AULL,0x19C4F068CB168586ULL,0x50EE6409AF11FAEFULL,0x7DF317D5C04EABA4ULL,
-	0x7A567C5498B4C6A9ULL,0xB6BBFB804F42188EULL,0x3CC22BCF3BC5CD0BULL,0xD04336EAAA397713ULL,
-	0xF02FAC1BEC33132CULL,0x2506DBA7F0D3488DULL,0xD7E65D6BF2C31A1EULL,0x5EB9B2161FF820F5ULL,
-	0x842E0650C46E0F9FULL,0x716BEB1D9E843001ULL,0xA933758CAB315ED4ULL,0x3FE414FDA2792265ULL,
-	0x27C9F1701EF00932ULL,0x73A4C1CA70A771BEULL,0x94184BA6E76B3D0EULL,0x40D829FF8C14C87EULL,
-	0x0FBEC3FAC77674CBULL,0x3616A9634A6A9572ULL,0x8F139119C25EF937ULL,0xF545ED4D5AEA3F9EULL,
-	0xE802499650BA387BULL,0x6437E7BD0B582E22ULL,0xE6559F89E053E261ULL,0x80AD52E305288DFCULL,
-	0x6DC55A23E34B9935ULL,0xDE14E0F51AD0AD09ULL,0xC6390578A659865EULL,0x96D7617109487CB1ULL,
-	0xE2D6CB3A21156002ULL,0x01E915E5779FAED1ULL,0xADB0213F6A77DCB7ULL,0x9880B76EB9A1A6ABULL,
-	0x5D9F8D248644CF9BULL,0xFD5E4536C5662658ULL,0xF1C6B9FE9BACBDFDULL,0xEACD6341BE9979C4ULL,
-	0xEFA7221708405576ULL,0x510771ECD88E543EULL,0xC2BA51CB671F043DULL,0x0AD482AC71AF5879ULL,
-	0xFE787A045CDAC936ULL,0xB238AF338E049AEDULL,0xBD866CC94972EE26ULL,0x615DA6EBBD810290ULL,
-	0x3295FDD08B2C1711ULL,0xF834046073BF0AEAULL,0xF3099329758FFC42ULL,0x1CAEB13E7DCFA934ULL,
-	0xBA2307481188832BULL,0x24EFCE42874CE65CULL,0x0E57D61FB0E9DA1AULL,0xB3D1BAD6F99B343CULL,
-	0xC0757B1C893C4582ULL,0x2B510DB8403A9297ULL,0x5C7698C1F1DB614AULL,0x3E0D0118D5E68CB4ULL,
-	0xD60F488E855CB4CFULL,0xAE961E0DF3CB33D9ULL,0x3A8E55AB14A00ED7ULL,0x42170328623789C1ULL,
-	0x838B6DD19C946292ULL,0x895FEF7DED3B3AEBULL,0xCFCBB8E64E4A3149ULL,0x064C7E642F65C3DCULL,
-	0x3D2B3E2A4C5A63DAULL,0x5BD3F340A9210C47ULL,0xB474D157A1615931ULL,0xAC5934DA1DE87266ULL,
-	0x6EE365117AF7765BULL,0xC86ED36716B05C44ULL,0x9BA6885C201D49C5ULL,0xB905387A88346C45ULL,
-	0x131072C4BAB9DDFFULL,0xBF49461EA751AF99ULL,0xD52977BC1CE05BA1ULL,0xB0F785E46027DB52ULL,
-	0x546D30BA6E57788CULL,0x305AD707650F56AEULL,0xC987C682612FF295ULL,0xA5AB8944F5FBC571ULL,
-	0x7ED528E759F244CAULL,0x8DDCBBCE2C7DB888ULL,0xAA154ABE328DB1BAULL,0x1E619BE993ECE88BULL,
-	0x09F2BD9EE813B717ULL,0x7401AA4B285D1CB3ULL,0x21858F143195CAEEULL,0x48C381841398D1B8ULL,
-	0xFCB750D3B2F98889ULL,0x39A86A998D1CE1B9ULL,0x1F888E0CE473465AULL,0x7899568376978716ULL,
-	0x02CF2AD7EE2341BFULL,0x85C713B5B3F1A14EULL,0xFF916FE12B4567E7ULL,0x7C1A0230B7D10575ULL,
-	0x0C98FCC85ECA9BA5ULL,0xA3E7F720DA9E06ADULL,0x6A6031A2BBB1F438ULL,0x973E74947ED7D260ULL,
-	0x2CF4663918C0FF9AULL,0x5F50A7F368678E24ULL,0x34D983B4A449D4CDULL,0x68AF1B755592B587ULL,
-	0x7F3C3D022E6DEA1BULL,0xABFC5F5B45121F6BULL,0x0D71E92D29553574ULL,0xDFFDF5106D4F03D8ULL,
-	0x081BA87B9F8C19C6ULL,0xDB7EA1A3AC0981BBULL,0xBBCA12AD66172DFAULL,0x79704366010829C7ULL,
-	0x179326777BFF5F9CULL,0x0000000000000000ULL,0xEB2476A4C906D715ULL,0x724DD42F0738DF6FULL,
-	0xB752EE6538DDB65FULL,0x37FFBC863DF53BA3ULL,0x8EFA84FCB5C157E6ULL,0xE9EB5C73272596AAULL,
-	0x1B0BDABF2535C439ULL,0x86E12C872A4D4E20ULL,0x9969A28BCE3E087AULL,0xFAFB2EB79D9C4B55ULL,
-	0x056A4156B6D92CB2ULL,0x5A3AE6A5DEBEA296ULL,0x22A3B026A8292580ULL,0x53C85B3B36AD1581ULL,
-	0xB11E900117B87583ULL,0xC51F3A4A3FE56930ULL,0xE019E1EDCF3621BDULL,0xEC811D2591FCBA18ULL,
-	0x445B7D4C4D524A1DULL,0xA8DA6069DCAEF005ULL,0x58F5CC72309DE329ULL,0xD4C062596B7FF570ULL,
-	0xCE22AD0339D59F98ULL,0x591CD99747024DF8ULL,0x8B90C5AA03187B54ULL,0xF663D27FC356D0F0ULL,
-	0xD8589E9135B56ED5ULL,0x35309651D3D67A1CULL,0x12F96721CD26732EULL,0xD28C1C3D441A36ACULL,
-	0x492A946164077F69ULL,0x2D1D73DC6F5F514BULL,0x6F0A70F40D68D88AULL,0x60B4B30ECA1EAC41ULL,
-	0xD36509D83385987DULL,0x0B3D97490630F6A8ULL,0x9ECCC90A96C46577ULL,0xA20EE2C5AD01A87CULL,
-	0xE49AB55E0E70A3DEULL,0xA4429CA182646BA0ULL,0xDA97B446DB962F6AULL,0xCCED87D4D7F6DE27ULL,
-	0x2AB8185D37A53C46ULL,0x9F25DCEFE15BCBA6ULL,0xC19C6EF9FEA3EB53ULL,0xA764A3931BD884CEULL,
-	0x2FD2590B817C10F4ULL,0x56A21A6D80743933ULL,0xE573A0BB79EF0D0FULL,0x155C0CA095DC1E23ULL,
-	0x6C2C4FC694D437E4ULL,0x10364DF623053291ULL,0xDD32DFC7836C4267ULL,0x03263F3299BCEF6EULL,
-	0x66F8CD6AE57B6F9DULL,0x8C35AE2B5BE21659ULL,0x31B3C2E21290F87FULL,0x93BD2027BF915003ULL,
-	0x69460E90220D1B56ULL,0x299E276FAE19D328ULL,0x63928C3C53A2432FULL,0x7082FEF8E91B9ED0ULL,
-	0xBC6F792C3EED40F7ULL,0x4C40D537D2DE53DBULL,0x75E8BFAE5FC2B262ULL,0x4DA9C0D2A541FD0AULL,
-	0x4E8FFFE03CFD1264ULL,0x2620E495696FA7E3ULL,0xE1F0F408B8A98F6CULL,0xD1AA230FDDA6D9C2ULL,
-	0xC7D0109DD1C6288FULL,0x8A79D04F7487D585ULL,0x4694579BA3710BA2ULL,0x38417F7CFA834F68ULL,
-	0x1D47A4DB0A5007E5ULL,0x206C9AF1460A643FULL,0xA128DDF734BD4712ULL,0x8144470672B7232DULL,
-	0xF2E086CC02105293ULL,0x182DE58DBC892B57ULL,0xCAA1F9B0F8931DFBULL,0x6B892447CC2E5AE9ULL,
-	0xF9DD11850420A43BULL,0x4BE5BEB68A243ED6ULL,0x5584255F19C8D65DULL,0x3B67404E633FA006ULL,
-	0xA68DB6766C472A1FULL,0xF78AC79AB4C97E21ULL,0xC353442E1080AAECULL,0x9A4F9DB95782E714ULL
-},
-{
-	0x05BA7BC82C9B3220ULL,0x31A54665F8B65E4FULL,0xB1B651F77547F4D4ULL,0x8BFA0D857BA46682ULL,
-	0x85A96C5AA16A98BBULL,0x990FAEF908EB79C9ULL,0xA15E37A247F4A62DULL,0x76857DCD5D27741EULL,
-	0xF8C50B800A1820BCULL,0xBE65DCB201F7A2B4ULL,0x666D1B986F9426E7ULL,0x4CC921BF53C4E648ULL,
-	0x95410A0F93D9CA42ULL,0x20CDCCAA647BA4EFULL,0x429A4060890A1871ULL,0x0C4EA4F69B32B38BULL,
-	0xCCDA362DDE354CD3ULL,0x96DC23BC7C5B2FA9ULL,0xC309BB68AA851AB3ULL,0xD26131A73648E013ULL,
-	0x021DC52941FC4DB2ULL,0xCD5ADAB7704BE48AULL,0xA77965D984ED71E6ULL,0x32386FD61734BBA4ULL,
-	0xE82D6DD538AB7245ULL,0x5C2147EA6177B4B1ULL,0x5DA1AB70CF091CE8ULL,0xAC907FCE72B8BDFFULL,
-	0x57C85DFD972278A8ULL,0xA4E44C6A6B6F940DULL,0x3851995B4F1FDFE4ULL,0x62578CCAED71BC9EULL,
-	0xD9882BB0C01D2C0AULL,0x917B9D5D113C503BULL,0xA2C31E11A87643C6ULL,0xE463C923A399C1CEULL,
-	0xF71686C57EA876DCULL,0x87B4A973E096D509ULL,0xAF0D567D9D3A5814ULL,0xB40C2A3F59DCC6F4ULL,
-	0x3602F88495D121DDULL,0xD3E1DD3D9836484AULL,0xF945E71AA46688E5ULL,0x7518547EB2A591F5ULL,
-	0x9366587450C01D89ULL,0x9EA81018658C065BULL,0x4F54080CBC4603A3ULL,0x2D0384C65137BF3DULL,
-	0xDC325078EC861E2AULL,0xEA30A8FC79573FF7ULL,0x214D2030CA050CB6ULL,0x65F0322B8016C30CULL,
-	0x69BE96DD1B247087ULL,0xDB95EE9981E161B8ULL,0xD1FC1814D9CA05F8ULL,0x820ED2BBCC0DE729ULL,
-	0x63D76050430F14C7ULL,0x3BCCB0E8A09D3A0FULL,0x8E40764D573F54A2ULL,0x39D175C1E16177BDULL,
-	0x12F5A37C734F1F4BULL,0xAB37C12F1FDFC26DULL,0x5648B167395CD0F1ULL,0x6C04ED1537BF42A7ULL,
-	0xED97161D14304065ULL,0x7D6C67DAAB72B807ULL,0xEC17FA87BA4EE83CULL,0xDFAF79CB0304FBC1ULL,
-	0x733F060571BC463EULL,0x78D61C1287E98A27ULL,0xD07CF48E77B4ADA1ULL,0xB9C262536C90DD26ULL,
-	0xE2449B5860801605ULL,0x8FC09AD7F941FCFBULL,0xFAD8CEA94BE46D0EULL,0xA343F28B0608EB9FULL,
-	0x9B126BD04917347BULL,0x9A92874AE7699C22ULL,0x1B017C42C4E69EE0ULL,0x3A4C5C720EE39256ULL,
-	0x4B6E9F5E3EA399DAULL,0x6BA353F45AD83D35ULL,0xE7FEE0904C1B2425ULL,0x22D009832587E95DULL,
-	0x842980C00F1430E2ULL,0xC6B3C0A0861E2893ULL,0x087433A419D729F2ULL,0x341F3DADD42D6C6FULL,
-	0xEE0A3FAEFBB2A58EULL,0x4AEE73C490DD3183ULL,0xAAB72DB5B1A16A34ULL,0xA92A04065E238FDFULL,
-	0x7B4B35A1686B6FCCULL,0x6A23BF6EF4A6956CULL,0x191CB96B851AD352ULL,0x55D598D4D6DE351AULL,
-	0xC9604DE5F2AE7EF3ULL,0x1CA6C2A3A981E172ULL,0xDE2F9551AD7A5398ULL,0x3025AAFF56C8F616ULL,
-	0x15521D9D1E2860D9ULL,0x506FE31CFA45073AULL,0x189C55F12B647B0BULL,0x0180EC9AAE7EA859ULL,
-	0x7CEC8B40050C105EULL,0x2350E5198BF94104ULL,0xEF8AD33455CC0DD7ULL,0x07A7BEE16D677F92ULL,
-	0xE5E325B90DE76997ULL,0x5A061591A26E637AULL,0xB611EF1618208B46ULL,0x09F4DF3EB7A981ABULL,
-	0x1EBB078AE87DACC0ULL,0xB791038CB65E231FULL,0x0FD38D4574B05660ULL,0x67EDF702C1EA8EBEULL,
-	0xBA5F4BE0831238CDULL,0xE3C477C2CEFEBE5CULL,0x0DCE486C354C1BD2ULL,0x8C5DB36416C31910ULL,
-	0x26EA9ED1A7627324ULL,0x039D29B3EF82E5EBULL,0x9F28FC82CBF2AE02ULL,0xA8AAE89CF05D2786ULL,
-	0x431AACFA2774B028ULL,0xCF471F9E31B7A938ULL,0x581BD0B8E3922EC8ULL,0xBC78199B400BEF06ULL,
-	0x90FB71C7BF42F862ULL,0x1F3BEB1046030499ULL,0x683E7A47B55AD8DEULL,0x988F4263A695D190ULL,
-	0xD808C72A6E638453ULL,0x0627527BC319D7CBULL,0xEBB04466D72997AEULL,0xE67E0C0AE2658C7CULL,
-	0x14D2F107B056C880ULL,0x7122C32C30400B8CULL,0x8A7AE11FD5DACEDBULL,0xA0DEDB38E98A0E74ULL,
-	0xAD109354DCC615A6ULL,0x0BE91A17F655CC19ULL,0x8DDD5FFEB8BDB149ULL,0xBFE53028AF890AEDULL,
-	0xD65BA6F5B4AD7A6AULL,0x7956F0882997227EULL,0x10E8665532B352F9ULL,0x0E5361DFDACEFE39ULL,
-	0xCEC7F3049FC90161ULL,0xFF62B561677F5F2EULL,0x975CCF26D22587F0ULL,0x51EF0F86543BAF63ULL,
-	0x2F1E41EF10CBF28FULL,0x52722635BBB94A88ULL,0xAE8DBAE73344F04DULL,0x410769D36688FD9AULL,
-	0xB3AB94DE34BBB966ULL,0x801317928DF1AA9BULL,0xA564A0F0C5113C54ULL,0xF131D4BEBDB1A117ULL,
-	0x7F71A2F3EA8EF5B5ULL,0x40878549C8F655C3ULL,0x7EF14E6944F05DECULL,0xD44663DCF55137D8ULL,
-	0xF2ACFD0D523344FCULL,0x0000000000000000ULL,0x5FBC6E598EF5515AULL,0x16CF342EF1AA8532ULL,
-	0xB036BD6DDB395C8DULL,0x13754FE6DD31B712ULL,0xBBDFA77A2D6C9094ULL,0x89E7C8AC3A582B30ULL,
-	0x3C6B0E09CDFA459DULL,0xC4AE0589C7E26521ULL,0x49735A777F5FD468ULL,0xCAFD64561D2C9B18ULL,
-	0xDA1502032F9FC9E1ULL,0x8867243694268369ULL,0x3782141E3BAF8984ULL,0x9CB5D53124704BE9ULL,
-	0xD7DB4A6F1AD3D233ULL,0xA6F989432A93D9BFULL,0x9D3539AB8A0EE3B0ULL,0x53F2CAAF15C7E2D1ULL,
-	0x6E19283C76430F15ULL,0x3DEBE2936384EDC4ULL,0x5E3C82C3208BF903ULL,0x33B8834CB94A13FDULL,
-	0x6470DEB12E686B55ULL,0x359FD1377A53C436ULL,0x61CAA57902F35975ULL,0x043A975282E59A79ULL,
-	0xFD7F70482683129CULL,0xC52EE913699CCD78ULL,0x28B9FF0E7DAC8D1DULL,0x5455744E78A09D43ULL,
-	0xCB7D88CCB3523341ULL,0x44BD121B4A13CFBAULL,0x4D49CD25FDBA4E11ULL,0x3E76CB208C06082FULL,
-	0x3FF627BA2278A076ULL,0xC28957F204FBB2EAULL,0x453DFE81E46D67E3ULL,0x94C1E6953DA7621BULL,
-	0x2C83685CFF491764ULL,0xF32C1197FC4DECA5ULL,0x2B24D6BD922E68F6ULL,0xB22B78449AC5113FULL,
-	0x48F3B6EDD1217C31ULL,0x2E9EAD75BEB55AD6ULL,0x174FD8B45FD42D6BULL,0x4ED4E4961238ABFAULL,
-	0x92E6B4EEFEBEB5D0ULL,0x46A0D7320BEF8208ULL,0x47203BA8A5912A51ULL,0x24F75BF8E69E3E96ULL,
-	0xF0B1382413CF094EULL,0xFEE259FBC901F777ULL,0x276A724B091CDB7DULL,0xBDF8F501EE75475FULL,
-	0x599B3C224DEC8691ULL,0x6D84018F99C1EAFEULL,0x7498B8E41CDB39ACULL,0xE0595E71217C5BB7ULL,
-	0x2AA43A273C50C0AFULL,0xF50B43EC3F543B6EULL,0x838E3E2162734F70ULL,0xC09492DB4507FF58ULL,
-	0x72BFEA9FDFC2EE67ULL,0x11688ACF9CCDFAA0ULL,0x1A8190D86A9836B9ULL,0x7ACBD93BC615C795ULL,
-	0xC7332C3A286080CAULL,0x863445E94EE87D50ULL,0xF6966A5FD0D6DE85ULL,0xE9AD814F96D5DA1CULL,
-	0x70A22FB69E3EA3D5ULL,0x0A69F68D582B6440ULL,0xB8428EC9C2EE757FULL,0x604A49E3AC8DF12CULL,
-	0x5B86F90B0C10CB23ULL,0xE1D9B2EB8F02F3EEULL,0x29391394D3D22544ULL,0xC8E0A17F5CD0D6AAULL,
-	0xB58CC6A5F7A26EADULL,0x8193FB08238F02C2ULL,0xD5C68F465B2F9F81ULL,0xFCFF9CD288FDBAC5ULL,
-	0x77059157F359DC47ULL,0x1D262E3907FF492BULL,0xFB582233E59AC557ULL,0xDDB2BCE242F8B673ULL,
-	0x2577B76248E096CFULL,0x6F99C4A6D83DA74CULL,0xC1147E41EB795701ULL,0xF48BAF76912A9337ULL
-},
-{
-	0x3EF29D249B2C0A19ULL,0xE9E16322B6F8622FULL,0x5536994047757F7AULL,0x9F4D56D5A47B0B33ULL,
-	0x822567466AA1174CULL,0xB8F5057DEB082FB2ULL,0xCC48C10BF4475F53ULL,0x373088D4275DEC3AULL,
-	0x968F4325180AED10ULL,0x173D232CF7016151ULL,0xAE4ED09F946FCC13ULL,0xFD4B4741C4539873ULL,
-	0x1B5B3F0DD9933765ULL,0x2FFCB0967B644052ULL,0xE02376D20A89840CULL,0xA3AE3A70329B18D7ULL,
-	0x419CBD2335DE8526ULL,0xFAFEBF115B7C3199ULL,0x0397074F85AA9B0DULL,0xC58AD4FB4836B970ULL,
-	0xBEC60BE3FC4104A8ULL,0x1EFF36DC4B708772ULL,0x131FDC33ED8453B6ULL,0x0844E33E341764D3ULL,
-	0x0FF11B6EAB38CD39ULL,0x64351F0A7761B85AULL,0x3B5694F509CFBA0EULL,0x30857084B87245D0ULL,
-	0x47AFB3BD2297AE3CULL,0xF2BA5C2F6F6B554AULL,0x74BDC4761F4F70E1ULL,0xCFDFC64471EDC45EULL,
-	0xE610784C1DC0AF16ULL,0x7ACA29D63C113F28ULL,0x2DED411776A859AFULL,0xAC5F211E99A3D5EEULL,
-	0xD484F949A87EF33BULL,0x3CE36CA596E013E4ULL,0xD120F0983A9D432CULL,0x6BC40464DC597563ULL,
-	0x69D5F5E5D1956C9EULL,0x9AE95F043698BB24ULL,0xC9ECC8DA66A4EF44ULL,0xD69508C8A5B2EAC6ULL,
-	0xC40C2235C0503B80ULL,0x38C193BA8C652103ULL,0x1CEEC75D46BC9E8FULL,0xD331011937515AD1ULL,
-	0xD8E2E56886ECA50FULL,0xB137108D5779C991ULL,0x709F3B6905CA4206ULL,0x4FEB50831680CAEFULL,
-	0xEC456AF3241BD238ULL,0x58D673AFE181ABBEULL,0x242F54E7CAD9BF8CULL,0x0211F1810DCC19FDULL,
-	0x90BC4DBB0F43C60AULL,0x9518446A9DA0761DULL,0xA1BFCBF13F57012AULL,0x2BDE4F8961E172B5ULL,
-	0x27B853A84F732481ULL,0xB0B1E643DF1F4B61ULL,0x18CC38425C39AC68ULL,0xD2B7F7D7BF37D821ULL,
-	0x3103864A3014C720ULL,0x14AA246372ABFA5CULL,0x6E600DB54EBAC574ULL,0x394765740403A3F3ULL,
-	0x09C215F0BC71E623ULL,0x2A58B947E987F045ULL,0x7B4CDF18B477BDD8ULL,0x9709B5EB906C6FE0ULL,
-	0x73083C268060D90BULL,0xFEDC400E41F9037EULL,0x284948C6E44BE9B8ULL,0x728ECAE808065BFBULL,
-	0x06330E9E17492B1AULL,0x5950856169E7294EULL,0xBAE4F4FCE6C4364FULL,0xCA7BCF95E30E7449ULL,
-	0x7D7FD186A33E96C2ULL,0x52836110D85AD690ULL,0x4DFAA1021B4CD312ULL,0x913ABB75872544FAULL,
-	0xDD46ECB9140F1518ULL,0x3D659A6B1E869114ULL,0xC23F2CABD719109AULL,0xD713FE062DD46836ULL,
-	0xD0A60656B2FBC1DCULL,0x221C5A79DD909496ULL,0xEFD26DBCA1B14935ULL,0x0E77EDA0235E4FC9ULL,
-	0xCBFD395B6B68F6B9ULL,0x0DE0EAEFA6F4D4C4ULL,0x0422FF1F1A8532E7ULL,0xF969B85EDED6AA94ULL,
-	0x7F6E2007AEF28F3FULL,0x3AD0623B81A938FEULL,0x6624EE8B7AADA1A7ULL,0xB682E8DDC856607BULL,
-	0xA78CC56F281E2A30ULL,0xC79B257A45FAA08DULL,0x5B4174E0642B30B3ULL,0x5F638BFF7EAE0254ULL,
-	0x4BC9AF9C0C05F808ULL,0xCE59308AF98B46AEULL,0x8FC58DA9CC55C388ULL,0x803496C7676D0EB1ULL,
-	0xF33CAAE1E70DD7BAULL,0xBB6202326EA2B4BFULL,0xD5020F87201871CBULL,0x9D5CA754A9B712CEULL,
-	0x841669D87DE83C56ULL,0x8A6184785EB6739FULL,0x420BBA6CB0741E2BULL,0xF12D5B60EAC1CE47ULL,
-	0x76AC35F71283691CULL,0x2C6BB7D9FECEDB5FULL,0xFCCDB18F4C351A83ULL,0x1F79C012C3160582ULL,
-	0xF0ABADAE62A74CB7ULL,0xE1A5801C82EF06FCULL,0x67A21845F2CB2357ULL,0x5114665F5DF04D9DULL,
-	0xBF40FD2D74278658ULL,0xA0393D3FB73183DAULL,0x05A409D192E3B017ULL,0xA9FB28CF0B4065F9ULL,
-	0x25A9A22942BF3D7CULL,0xDB75E22703463E02ULL,0xB326E10C5AB5D06CULL,0xE7968E8295A62DE6ULL,
-	0xB973F3B3636EAD42ULL,0xDF571D3819C30CE5ULL,0xEE549B7229D7CBC5ULL,0x12992AFD65E2D146ULL,
-	0xF8EF4E9056B02864ULL,0xB7041E134030E28BULL,0xC02EDD2ADAD50967ULL,0x932B4AF48AE95D07ULL,
-	0x6FE6FB7BC6DC4784ULL,0x239AACB755F61666ULL,0x401A4BEDBDB807D6ULL,0x485EA8D389AF6305ULL,
-	0xA41BC220ADB4B13DULL,0x753B32B89729F211ULL,0x997E584BB3322029ULL,0x1D683193CEDA1C7FULL,
-	0xFF5AB6C0C99F818EULL,0x16BBD5E27F67E3A1ULL,0xA59D34EE25D233CDULL,0x98F8AE853B54A2D9ULL,
-	0x6DF70AFACB105E79ULL,0x795D2E99B9BBA425ULL,0x8E437B6744334178ULL,0x0186F6CE886682F0ULL,
-	0xEBF092A3BB347BD2ULL,0xBCD7FA62F18D1D55ULL,0xADD9D7D011C5571EULL,0x0BD3E471B1BDFFDEULL,
-	0xAA6C2F808EEAFEF4ULL,0x5EE57D31F6C880A4ULL,0xF50FA47FF044FCA0ULL,0x1ADDC9C351F5B595ULL,
-	0xEA76646D3352F922ULL,0x0000000000000000ULL,0x85909F16F58EBEA6ULL,0x46294573AAF12CCCULL,
-	0x0A5512BF39DB7D2EULL,0x78DBD85731DD26D5ULL,0x29CFBE086C2D6B48ULL,0x218B5D36583A0F9BULL,
-	0x152CD2ADFACD78ACULL,0x83A39188E2C795BCULL,0xC3B9DA655F7F926AULL,0x9ECBA01B2C1D89C3ULL,
-	0x07B5F8509F2FA9EAULL,0x7EE8D6C926940DCFULL,0x36B67E1AAF3B6ECAULL,0x86079859702425ABULL,
-	0xFB7849DFD31AB369ULL,0x4C7C57CC932A51E2ULL,0xD96413A60E8A27FFULL,0x263EA566C715A671ULL,
-	0x6C71FC344376DC89ULL,0x4A4F595284637AF8ULL,0xDAF314E98B20BCF2ULL,0x572768C14AB96687ULL,
-	0x1088DB7C682EC8BBULL,0x887075F9537A6A62ULL,0x2E7A4658F302C2A2ULL,0x619116DBE582084DULL,
-	0xA87DDE018326E709ULL,0xDCC01A779C6997E8ULL,0xEDC39C3DAC7D50C8ULL,0xA60A33A1A078A8C0ULL,
-	0xC1A82BE452B38B97ULL,0x3F746BEA134A88E9ULL,0xA228CCBEBAFD9A27ULL,0xABEAD94E068C7C04ULL,
-	0xF48952B178227E50ULL,0x5CF48CB0FB049959ULL,0x6017E0156DE48ABDULL,0x4438B4F2A73D3531ULL,
-	0x8C528AE649FF5885ULL,0xB515EF924DFCFB76ULL,0x0C661C212E925634ULL,0xB493195CC59A7986ULL,
-	0x9CDA519A21D1903EULL,0x32948105B5BE5C2DULL,0x194ACE8CD45F2E98ULL,0x438D4CA238129CDBULL,
-	0x9B6FA9CABEFE39D4ULL,0x81B26009EF0B8C41ULL,0xDED1EBF691A58E15ULL,0x4E6DA64D9EE6481FULL,
-	0x54B06F8ECF13FD8AULL,0x49D85E1D01C9E1F5ULL,0xAFC826511C094EE3ULL,0xF698A33075EE67ADULL,
-	0x5AC7822EEC4DB243ULL,0x8DD47C28C199DA75ULL,0x89F68337DB1CE892ULL,0xCDCE37C57C21DDA3ULL,
-	0x530597DE503C5460ULL,0x6A42F2AA543FF793ULL,0x5D727A7E73621BA9ULL,0xE232875307459DF1ULL,
-	0x56A19E0FC2DFE477ULL,0xC61DD3B4CD9C227DULL,0xE5877F03986A341BULL,0x949EB2A415C6F4EDULL,
-	0x6206119460289340ULL,0x6380E75AE84E11B0ULL,0x8BE772B6D6D0F16FULL,0x50929091D596CF6DULL,
-	0xE86795EC3E9EE0DFULL,0x7CF927482B581432ULL,0xC86A3E14EEC26DB4ULL,0x7119CDA78DACC0F6ULL,
-	0xE40189CD100CB6EBULL,0x92ADBC3A028FDFF7ULL,0xB2A017C2D2D3529CULL,0x200DABF8D05C8D6BULL,
-	0x34A78F9BA2F77737ULL,0xE3B4719D8F231F01ULL,0x45BE423C2F5BB7C1ULL,0xF71E55FEFD88E55DULL,
-	0x6853032B59F3EE6EULL,0x65B3E9C4FF073AAAULL,0x772AC3399AE5EBECULL,0x87816E97F842A75BULL,
-	0x110E2DB2E0484A4BULL,0x331277CB3DD8DEDDULL,0xBD510CAC79EB9FA5ULL,0x352179552A91F5C7ULL
-},
-{
-	0x8AB0A96846E06A6DULL,0x43C7E80B4BF0B33AULL,0x08C9B3546B161EE5ULL,0x39F1C235EBA990BEULL,
-	0xC1BEF2376606C7B2ULL,0x2C209233614569AAULL,0xEB01523B6FC3289AULL,0x946953AB935ACEDDULL,
-	0x272838F63E13340EULL,0x8B0455ECA12BA052ULL,0x77A1B2C4978FF8A2ULL,0xA55122CA13E54086ULL,
-	0x2276135862D3F1CDULL,0xDB8DDFDE08B76CFEULL,0x5D1E12C89E4A178AULL,0x0E56816B03969867ULL,
-	0xEE5F79953303ED59ULL,0xAFED748BAB78D71DULL,0x6D929F2DF93E53EEULL,0xF5D8A8F8BA798C2AULL,
-	0xF619B1698E39CF6BULL,0x95DDAF2F749104E2ULL,0xEC2A9C80E0886427ULL,0xCE5C8FD8825B95EAULL,
-	0xC4E0D9993AC60271ULL,0x4699C3A5173076F9ULL,0x3D1B151F50A29F42ULL,0x9ED505EA2BC75946ULL,
-	0x34665ACFDC7F4B98ULL,0x61B1FB53292342F7ULL,0xC721C0080E864130ULL,0x8693CD1696FD7B74ULL,
-	0x872731927136B14BULL,0xD3446C8A63A1721BULL,0x669A35E8A6680E4AULL,0xCAB658F239509A16ULL,
-	0xA4E5DE4EF42E8AB9ULL,0x37A7435EE83F08D9ULL,0x134E6239E26C7F96ULL,0x82791A3C2DF67488ULL,
-	0x3F6EF00A8329163CULL,0x8E5A7E42FDEB6591ULL,0x5CAAEE4C7981DDB5ULL,0x19F234785AF1E80DULL,
-	0x255DDDE3ED98BD70ULL,0x50898A32A99CCCACULL,0x28CA4519DA4E6656ULL,0xAE59880F4CB31D22ULL,
-	0x0D9798FA37D6DB26ULL,0x32F968F0B4FFCD1AULL,0xA00F09644F258545ULL,0xFA3AD5175E24DE72ULL,
-	0xF46C547C5DB24615ULL,0x713E80FBFF0F7E20ULL,0x7843CF2B73D2AAFAULL,0xBD17EA36AEDF62B4ULL,
-	0xFD111BACD16F92CFULL,0x4ABAA7DBC72D67E0ULL,0xB3416B5DAD49FAD3ULL,0xBCA316B24914A88BULL,
-	0x15D150068AECF914ULL,0xE27C1DEBE31EFC40ULL,0x4FE48C759BEDA223ULL,0x7EDCFD141B522C78ULL,
-	0x4E5070F17C26681CULL,0xE696CAC15815F3BCULL,0x35D2A64B3BB481A7ULL,0x800CFF29FE7DFDF6ULL,
-	0x1ED9FAC3D5BAA4B0ULL,0x6C2663A91EF599D1ULL,0x03C1199134404341ULL,0xF7AD4DED69F20554ULL,
-	0xCD9D9649B61BD6ABULL,0xC8C3BDE7EADB1368ULL,0xD131899FB02AFB65ULL,0x1D18E352E1FAE7F1ULL,
-	0xDA39235AEF7CA6C1ULL,0xA1BBF5E0A8EE4F7AULL,0x91377805CF9A0B1EULL,0x3138716180BF8E5BULL,
-	0xD9F83ACBDB3CE580ULL,0x0275E515D38B897EULL,0x472D3F21F0FBBCC6ULL,0x2D946EB7868EA395ULL,
-	0xBA3C248D21942E09ULL,0xE7223645BFDE3983ULL,0xFF64FEB902E41BB1ULL,0xC97741630D10D957ULL,
-	0xC3CB1722B58D4ECCULL,0xA27AEC719CAE0C3BULL,0x99FECB51A48C15FBULL,0x1465AC826D27332BULL,
-	0xE1BD047AD75EBF01ULL,0x79F733AF941960C5ULL,0x672EC96C41A3C475ULL,0xC27FEBA6524684F3ULL,
-	0x64EFD0FD75E38734ULL,0xED9E60040743AE18ULL,0xFB8E2993B9EF144DULL,0x38453EB10C625A81ULL,
-	0x6978480742355C12ULL,0x48CF42CE14A6EE9EULL,0x1CAC1FD606312DCEULL,0x7B82D6BA4792E9BBULL,
-	0x9D141C7B1F871A07ULL,0x5616B80DC11C4A2EULL,0xB849C198F21FA777ULL,0x7CA91801C8D9A506ULL,
-	0xB1348E487EC273ADULL,0x41B20D1E987B3A44ULL,0x7460AB55A3CFBBE3ULL,0x84E628034576F20AULL,
-	0x1B87D16D897A6173ULL,0x0FE27DEFE45D5258ULL,0x83CDE6B8CA3DBEB7ULL,0x0C23647ED01D1119ULL,
-	0x7A362A3EA0592384ULL,0xB61F40F3F1893F10ULL,0x75D457D1440471DCULL,0x4558DA34237035B8ULL,
-	0xDCA6116587FC2043ULL,0x8D9B67D3C9AB26D0ULL,0x2B0B5C88EE0E2517ULL,0x6FE77A382AB5DA90ULL,
-	0x269CC472D9D8FE31ULL,0x63C41E46FAA8CB89ULL,0xB7ABBC771642F52FULL,0x7D1DE4852F126F39ULL,
-	0xA8C6BA3024339BA0ULL,0x600507D7CEE888C8ULL,0x8FEE82C61A20AFAEULL,0x57A2448926D78011ULL,
-	0xFCA5E72836A458F0ULL,0x072BCEBB8F4B4CBDULL,0x497BBE4AF36D24A1ULL,0x3CAFE99BB769557DULL,
-	0x12FA9EBD05A7B5A9ULL,0xE8C04BAA5B836BDBULL,0x4273148FAC3B7905ULL,0x908384812851C121ULL,
-	0xE557D3506C55B0FDULL,0x72FF996ACB4F3D61ULL,0x3EDA0C8E64E2DC03ULL,0xF0868356E6B949E9ULL,
-	0x04EAD72ABB0B0FFCULL,0x17A4B5135967706AULL,0xE3C8E16F04D5367FULL,0xF84F30028DAF570CULL,
-	0x1846C8FCBD3A2232ULL,0x5B8120F7F6CA9108ULL,0xD46FA231ECEA3EA6ULL,0x334D947453340725ULL,
-	0x58403966C28AD249ULL,0xBED6F3A79A9F21F5ULL,0x68CCB483A5FE962DULL,0xD085751B57E1315AULL,
-	0xFED0023DE52FD18EULL,0x4B0E5B5F20E6ADDFULL,0x1A332DE96EB1AB4CULL,0xA3CE10F57B65C604ULL,
-	0x108F7BA8D62C3CD7ULL,0xAB07A3A11073D8E1ULL,0x6B0DAD1291BED56CULL,0xF2F366433532C097ULL,
-	0x2E557726B2CEE0D4ULL,0x0000000000000000ULL,0xCB02A476DE9B5029ULL,0xE4E32FD48B9E7AC2ULL,
-	0x734B65EE2C84F75EULL,0x6E5386BCCD7E10AFULL,0x01B4FC84E7CBCA3FULL,0xCFE8735C65905FD5ULL,
-	0x3613BFDA0FF4C2E6ULL,0x113B872C31E7F6E8ULL,0x2FE18BA255052AEBULL,0xE974B72EBC48A1E4ULL,
-	0x0ABC5641B89D979BULL,0xB46AA5E62202B66EULL,0x44EC26B0C4BBFF87ULL,0xA6903B5B27A503C7ULL,
-	0x7F680190FC99E647ULL,0x97A84A3AA71A8D9CULL,0xDD12EDE16037EA7CULL,0xC554251DDD0DC84EULL,
-	0x88C54C7D956BE313ULL,0x4D91696048662B5DULL,0xB08072CC9909B992ULL,0xB5DE5962C5C97C51ULL,
-	0x81B803AD19B637C9ULL,0xB2F597D94A8230ECULL,0x0B08AAC55F565DA4ULL,0xF1327FD2017283D6ULL,
-	0xAD98919E78F35E63ULL,0x6AB9519676751F53ULL,0x24E921670A53774FULL,0xB9FD3D1C15D46D48ULL,
-	0x92F66194FBDA485FULL,0x5A35DC7311015B37ULL,0xDED3F4705477A93DULL,0xC00A0EB381CD0D8DULL,
-	0xBB88D809C65FE436ULL,0x16104997BEACBA55ULL,0x21B70AC95693B28CULL,0x59F4C5E225411876ULL,
-	0xD5DB5EB50B21F499ULL,0x55D7A19CF55C096FULL,0xA97246B4C3F8519FULL,0x8552D487A2BD3835ULL,
-	0x54635D181297C350ULL,0x23C2EFDC85183BF2ULL,0x9F61F96ECC0C9379ULL,0x534893A39DDC8FEDULL,
-	0x5EDF0B59AA0A54CBULL,0xAC2C6D1A9F38945CULL,0xD7AEBBA0D8AA7DE7ULL,0x2ABFA00C09C5EF28ULL,
-	0xD84CC64F3CF72FBFULL,0x2003F64DB15878B3ULL,0xA724C7DFC06EC9F8ULL,0x069F323F68808682ULL,
-	0xCC296ACD51D01C94ULL,0x055E2BAE5CC0C5C3ULL,0x6270E2C21D6301B6ULL,0x3B842720382219C0ULL,
-	0xD2F0900E846AB824ULL,0x52FC6F277A1745D2ULL,0xC6953C8CE94D8B0FULL,0xE009F8FE3095753EULL,
-	0x655B2C7992284D0BULL,0x984A37D54347DFC4ULL,0xEAB5AEBF8808E2A5ULL,0x9A3FD2C090CC56BAULL,
-	0x9CA0E0FFF84CD038ULL,0x4C2595E4AFADE162ULL,0xDF6708F4B3BC6302ULL,0xBF620F237D54EBCAULL,
-	0x93429D101C118260ULL,0x097D4FD08CDDD4DAULL,0x8C2F9B572E60ECEFULL,0x708A7C7F18C4B41FULL,
-	0x3A30DBA4DFE9D3FFULL,0x4006F19A7FB0F07BULL,0x5F6BF7DD4DC19EF4ULL,0x1F6D064732716E8FULL,
-	0xF9FBCC866A649D33ULL,0x308C8DE567744464ULL,0x8971B0F972A0292CULL,0xD61A47243F61B7D8ULL,
-	0xEFEB8511D4C82766ULL,0x961CB6BE40D147A3ULL,0xAAB35F25F7B812DEULL,0x76154E407044329DULL,
-	0x513D76B64E570693ULL,0xF3479AC7D2F90AA8ULL,0x9B8B2E4477079C85ULL,0x297EB99D3D85AC69ULL
-},
-{
-	0x7E37E62DFC7D40C3ULL,0x776F25A4EE939E5BULL,0xE045C850DD8FB5ADULL,0x86ED5BA711FF1952ULL,
-	0xE91D0BD9CF616B35ULL,0x37E0AB256E408FFBULL,0x9607F6C031025A7AULL,0x0B02F5E116D23C9DULL,
-	0xF3D8486BFB50650CULL,0x621CFF27C40875F5ULL,0x7D40CB71FA5FD34AULL,0x6DAA6616DAA29062ULL,
-	0x9F5F354923EC84E2ULL,0xEC847C3DC507C3B3ULL,0x025A3668043CE205ULL,0xA8BF9E6C4DAC0B19ULL,
-	0xFA808BE2E9BEBB94ULL,0xB5B99C5277C74FA3ULL,0x78D9BC95F0397BCCULL,0xE332E50CDBAD2624ULL,
-	0xC74FCE129332797EULL,0x1729ECEB2EA709ABULL,0xC2D6B9F69954D1F8ULL,0x5D898CBFBAB8551AULL,
-	0x859A76FB17DD8ADBULL,0x1BE85886362F7FB5ULL,0xF6413F8FF136CD8AULL,0xD3110FA5BBB7E35CULL,
-	0x0A2FEED514CC4D11ULL,0xE83010EDCD7F1AB9ULL,0xA1E75DE55F42D581ULL,0xEEDE4A55C13B21B6ULL,
-	0xF2F5535FF94E1480ULL,0x0CC1B46D1888761EULL,0xBCE15FDB6529913BULL,0x2D25E8975A7181C2ULL,
-	0x71817F1CE2D7A554ULL,0x2E52C5CB5C53124BULL,0xF9F7A6BEEF9C281DULL,0x9E722E7D21F2F56EULL,
-	0xCE170D9B81DCA7E6ULL,0x0E9B82051CB4941BULL,0x1E712F623C49D733ULL,0x21E45CFA42F9F7DCULL,
-	0xCB8E7A7F8BBA0F60ULL,0x8E98831A010FB646ULL,0x474CCF0D8E895B23ULL,0xA99285584FB27A95ULL,
-	0x8CC2B57205335443ULL,0x42D5B8E984EFF3A5ULL,0x012D1B34021E718CULL,0x57A6626AAE74180BULL,
-	0xFF19FC06E3D81312ULL,0x35BA9D4D6A7C6DFEULL,0xC9D44C178F86ED65ULL,0x506523E6A02E5288ULL,
-	0x03772D5C06229389ULL,0x8B01F4FE0B691EC0ULL,0xF8DABD8AED825991ULL,0x4C4E3AEC985B67BEULL,
-	0xB10DF0827FBF96A9ULL,0x6A69279AD4F8DAE1ULL,0xE78689DCD3D5FF2EULL,0x812E1A2B1FA553D1ULL,
-	0xFBAD90D6EBA0CA18ULL,0x1AC543B234310E39ULL,0x1604F7DF2CB97827ULL,0xA6241C6951189F02ULL,
-	0x753513CCEAAF7C5EULL,0x64F2A59FC84C4EFAULL,0x247D2B1E489F5F5AULL,0xDB64D718AB474C48ULL,
-	0x79F4A7A1F2270A40ULL,0x1573DA832A9BEBAEULL,0x3497867968621C72ULL,0x514838D2A2302304ULL,
-	0xF0AF6537FD72F685ULL,0x1D06023E3A6B44BAULL,0x678588C3CE6EDD73ULL,0x66A893F7CC70ACFFULL,
-	0xD4D24E29B5EDA9DFULL,0x3856321470EA6A6CULL,0x07C3418C0E5A4A83ULL,0x2BCBB22F5635BACDULL,
-	0x04B46CD00878D90AULL,0x06EE5AB80C443B0FULL,0x3B211F4876C8F9E5ULL,0x0958C38912EEDE98ULL,
-	0xD14B39CDBF8B0159ULL,0x397B292072F41BE0ULL,0x87C0409313E168DEULL,0xAD26E98847CAA39FULL,
-	0x4E140C849C6785BBULL,0xD5FF551DB7F3D853ULL,0xA0CA46D15D5CA40DULL,0xCD6020C787FE346FULL,
-	0x84B76DCF15C3FB57ULL,0xDEFDA0FCA121E4CEULL,0x4B8D7B6096012D3DULL,0x9AC642AD298A2C64ULL,
-	0x0875D8BD10F0AF14ULL,0xB357C6EA7B8374ACULL,0x4D6321D89A451632ULL,0xEDA96709C719B23FULL,
-	0xF76C24BBF328BC06ULL,0xC662D526912C08F2ULL,0x3CE25EC47892B366ULL,0xB978283F6F4F39BDULL,
-	0xC08C8F9E9D6833FDULL,0x4F3917B09E79F437ULL,0x593DE06FB2C08C10ULL,0xD6887841B1D14BDAULL,
-	0x19B26EEE32139DB0ULL,0xB494876675D93E2FULL,0x825937771987C058ULL,0x90E9AC783D466175ULL,
-	0xF1827E03FF6C8709ULL,0x945DC0A8353EB87FULL,0x4516F9658AB5B926ULL,0x3F9573987EB020EFULL,
-	0xB855330B6D514831ULL,0x2AE6A91B542BCB41ULL,0x6331E413C6160479ULL,0x408F8E8180D311A0ULL,
-	0xEFF35161C325503AULL,0xD06622F9BD9570D5ULL,0x8876D9A20D4B8D49ULL,0xA5533135573A0C8BULL,
-	0xE168D364DF91C421ULL,0xF41B09E7F50A2F8FULL,0x12B09B0F24C1A12DULL,0xDA49CC2CA9593DC4ULL,
-	0x1F5C34563E57A6BFULL,0x54D14F36A8568B82ULL,0xAF7CDFE043F6419AULL,0xEA6A2685C943F8BCULL,
-	0xE5DCBFB4D7E91D2BULL,0xB27ADDDE799D0520ULL,0x6B443CAED6E6AB6DULL,0x7BAE91C9F61BE845ULL,
-	0x3EB868AC7CAE5163ULL,0x11C7B65322E332A4ULL,0xD23C1491B9A992D0ULL,0x8FB5982E0311C7CAULL,
-	0x70AC6428E0C9D4D8ULL,0x895BC2960F55FCC5ULL,0x76423E90EC8DEFD7ULL,0x6FF0507EDE9E7267ULL,
-	0x3DCF45F07A8CC2EAULL,0x4AA06054941F5CB1ULL,0x5810FB5BB0DEFD9CULL,0x5EFEA1E3BC9AC693ULL,
-	0x6EDD4B4ADC8003EBULL,0x741808F8E8B10DD2ULL,0x145EC1B728859A22ULL,0x28BC9F7350172944ULL,
-	0x270A06424EBDCCD3ULL,0x972AEDF4331C2BF6ULL,0x059977E40A66A886ULL,0x2550302A4A812ED6ULL,
-	0xDD8A8DA0A7037747ULL,0xC515F87A970E9B7BULL,0x3023EAA9601AC578ULL,0xB7E3AA3A73FBADA6ULL,
-	0x0FB699311EAAE597ULL,0x0000000000000000ULL,0x310EF19D6204B4F4ULL,0x229371A644DB6455ULL,
-	0x0DECAF591A960792ULL,0x5CA4978BB8A62496ULL,0x1C2B190A38753536ULL,0x41A295B582CD602CULL,
-	0x3279DCC16426277DULL,0xC1A194AA9F764271ULL,0x139D803B26DFD0A1ULL,0xAE51C4D441E83016ULL,
-	0xD813FA44AD65DFC1ULL,0xAC0BF2BC45D4D213ULL,0x23BE6A9246C515D9ULL,0x49D74D08923DCF38ULL,
-	0x9D05032127D066E7ULL,0x2F7FDEFF5E4D63C7ULL,0xA47E2A0155247D07ULL,0x99B16FF12FA8BFEDULL,
-	0x4661D4398C972AAFULL,0xDFD0BBC8A33F9542ULL,0xDCA79694A51D06CBULL,0xB020EBB67DA1E725ULL,
-	0xBA0F0563696DAA34ULL,0xE4F1A480D5F76CA7ULL,0xC438E34E9510EAF7ULL,0x939E81243B64F2FCULL,
-	0x8DEFAE46072D25CFULL,0x2C08F3A3586FF04EULL,0xD7A56375B3CF3A56ULL,0x20C947CE40E78650ULL,
-	0x43F8A3DD86F18229ULL,0x568B795EAC6A6987ULL,0x8003011F1DBB225DULL,0xF53612D3F7145E03ULL,
-	0x189F75DA300DEC3CULL,0x9570DB9C3720C9F3ULL,0xBB221E576B73DBB8ULL,0x72F65240E4F536DDULL,
-	0x443BE25188ABC8AAULL,0xE21FFE38D9B357A8ULL,0xFD43CA6EE7E4F117ULL,0xCAA3614B89A47EECULL,
-	0xFE34E732E1C6629EULL,0x83742C431B99B1D4ULL,0xCF3A16AF83C2D66AULL,0xAAE5A8044990E91CULL,
-	0x26271D764CA3BD5FULL,0x91C4B74C3F5810F9ULL,0x7C6DD045F841A2C6ULL,0x7F1AFD19FE63314FULL,
-	0xC8F957238D989CE9ULL,0xA709075D5306EE8EULL,0x55FC5402AA48FA0EULL,0x48FA563C9023BEB4ULL,
-	0x65DFBEABCA523F76ULL,0x6C877D22D8BCE1EEULL,0xCC4D3BF385E045E3ULL,0xBEBB69B36115733EULL,
-	0x10EAAD6720FD4328ULL,0xB6CEB10E71E5DC2AULL,0xBDCC44EF6737E0B7ULL,0x523F158EA412B08DULL,
-	0x989C74C52DB6CE61ULL,0x9BEB59992B945DE8ULL,0x8A2CEFCA09776F4CULL,0xA3BD6B8D5B7E3784ULL,
-	0xEB473DB1CB5D8930ULL,0xC3FBA2C29B4AA074ULL,0x9C28181525CE176BULL,0x683311F2D0C438E4ULL,
-	0x5FD3BAD7BE84B71FULL,0xFC6ED15AE5FA809BULL,0x36CDB0116C5EFE77ULL,0x29918447520958C8ULL,
-	0xA29070B959604608ULL,0x53120EBAA60CC101ULL,0x3A0C047C74D68869ULL,0x691E0AC6D2DA4968ULL,
-	0x73DB4974E6EB4751ULL,0x7A838AFDF40599C9ULL,0x5A4ACD33B4E21F99ULL,0x6046C94FC03497F0ULL,
-	0xE6AB92E8D1CB8EA2ULL,0x3354C7F5663856F1ULL,0xD93EE170AF7BAE4DULL,0x616BD27BC22AE67CULL,
-	0x92B39A10397A8370ULL,0xABC8B3304B8E9890ULL,0xBF967287630B02B2ULL,0x5B67D607B6FC6E15ULL
-},
-{
-	0xD031C397CE553FE6ULL,0x16BA5B01B006B525ULL,0xA89BADE6296E70C8ULL,0x6A1F525D77D3435BULL,
-	0x6E103570573DFA0BULL,0x660EFB2A17FC95ABULL,0x76327A9E97634BF6ULL,0x4BAD9D6462458BF5ULL,
-	0xF1830CAEDBC3F748ULL,0xC5C8F542669131FFULL,0x95044A1CDC48B0CBULL,0x892962DF3CF8B866ULL,
-	0xB0B9E208E930C135ULL,0xA14FB3F0611A767CULL,0x8D2605F21C160136ULL,0xD6B71922FECC549EULL,
-	0x37089438A5907D8BULL,0x0B5DA38E5803D49CULL,0x5A5BCC9CEA6F3CBCULL,0xEDAE246D3B73FFE5ULL,
-	0xD2B87E0FDE22EDCEULL,0x5E54ABB1CA8185ECULL,0x1DE7F88FE80561B9ULL,0xAD5E1A870135A08CULL,
-	0x2F2ADBD665CECC76ULL,0x5780B5A782F58358ULL,0x3EDC8A2EEDE47B3FULL,0xC9D95C3506BEE70FULL,
-	0x83BE111D6C4E05EEULL,0xA603B90959367410ULL,0x103C81B4809FDE5DULL,0x2C69B6027D0C774AULL,
-	0x399080D7D5C87953ULL,0x09D41E16487406B4ULL,0xCDD63B1826505E5FULL,0xF99DC2F49B0298E8ULL,
-	0x9CD0540A943CB67FULL,0xBCA84B7F891F17C5ULL,0x723D1DB3B78DF2A6ULL,0x78AA6E71E73B4F2EULL,
-	0x1433E699A071670DULL,0x84F21BE454620782ULL,0x98DF3327B4D20F2FULL,0xF049DCE2D3769E5CULL,
-	0xDB6C60199656EB7AULL,0x648746B2078B4783ULL,0x32CD23598DCBADCFULL,0x1EA4955BF0C7DA85ULL,
-	0xE9A143401B9D46B5ULL,0xFD92A5D9BBEC21B8ULL,0xC8138C790E0B8E1BULL,0x2EE00B9A6D7BA562ULL,
-	0xF85712B893B7F1FCULL,0xEB28FED80BEA949DULL,0x564A65EB8A40EA4CULL,0x6C9988E8474A2823ULL,
-	0x4535898B121D8F2DULL,0xABD8C03231ACCBF4ULL,0xBA2E91CAB9867CBDULL,0x7960BE3DEF8E263AULL,
-	0x0C11A977602FD6F0ULL,0xCB50E1AD16C93527ULL,0xEAE22E94035FFD89ULL,0x2866D12F5DE2CE1AULL,
-	0xFF1B1841AB9BF390ULL,0x9F9339DE8CFE0D43ULL,0x964727C8C48A0BF7ULL,0x524502C6AAAE531CULL,
-	0x9B9C5EF3AC10B413ULL,0x4FA2FA4942AB32A5ULL,0x3F165A62E551122BULL,0xC74148DA76E6E3D7ULL,
-	0x924840E5E464B2A7ULL,0xD372AE43D69784DAULL,0x233B72A105E11A86ULL,0xA48A04914941A638ULL,
-	0xB4B68525C9DE7865ULL,0xDDEABAACA6CF8002ULL,0x0A9773C250B6BD88ULL,0xC284FFBB5EBD3393ULL,
-	0x8BA0DF472C8F6A4EULL,0x2AEF6CB74D951C32ULL,0x427983722A318D41ULL,0x73F7CDFFBF389BB2ULL,
-	0x074C0AF9382C026CULL,0x8A6A0F0B243A035AULL,0x6FDAE53C5F88931FULL,0xC68B98967E538AC3ULL,
-	0x44FF59C71AA8E639ULL,0xE2FCE0CE439E9229ULL,0xA20CDE2479D8CD40ULL,0x19E89FA2C8EBD8E9ULL,
-	0xF446BBCFF398270CULL,0x43B3533E2284E455ULL,0xD82F0DCD8E945046ULL,0x51066F12B26CE820ULL,
-	0xE73957AF6BC5426DULL,0x081ECE5A40C16FA0ULL,0x3B193D4FC5BFAB7BULL,0x7FE66488DF174D42ULL,
-	0x0E9814EF705804D8ULL,0x8137AC857C39D7C6ULL,0xB1733244E185A821ULL,0x695C3F896F11F867ULL,
-	0xF6CF0657E3EFF524ULL,0x1AABF276D02963D5ULL,0x2DA3664E75B91E5EULL,0x0289BD981077D228ULL,
-	0x90C1FD7DF413608FULL,0x3C5537B6FD93A917ULL,0xAA12107E3919A2E0ULL,0x0686DAB530996B78ULL,
-	0xDAA6B0559EE3826EULL,0xC34E2FF756085A87ULL,0x6D5358A44FFF4137ULL,0xFC587595B35948ACULL,
-	0x7CA5095CC7D5F67EULL,0xFB147F6C8B754AC0ULL,0xBFEB26AB91DDACF9ULL,0x6896EFC567A49173ULL,
-	0xCA9A31E11E7C5C33ULL,0xBBE44186B13315A9ULL,0x0DDB793B689ABFE4ULL,0x70B4A02BA7FA208EULL,
-	0xE47A3A7B7307F951ULL,0x8CECD5BE14A36822ULL,0xEEED49B923B144D9ULL,0x17708B4DB8B3DC31ULL,
-	0x6088219F2765FED3ULL,0xB3FA8FDCF1F27A09ULL,0x910B2D31FCA6099BULL,0x0F52C4A378ED6DCCULL,
-	0x50CCBF5EBAD98134ULL,0x6BD582117F662A4FULL,0x94CE9A50D4FDD9DFULL,0x2B25BCFB45207526ULL,
-	0x67C42B661F49FCBFULL,0x492420FC723259DDULL,0x03436DD418C2BB3CULL,0x1F6E4517F872B391ULL,
-	0xA08563BC69AF1F68ULL,0xD43EA4BAEEBB86B6ULL,0x01CAD04C08B56914ULL,0xAC94CACB0980C998ULL,
-	0x54C3D8739A373864ULL,0x26FEC5C02DBACAC2ULL,0xDEA9D778BE0D3B3EULL,0x040F672D20EEB950ULL,
-	0xE5B0EA377BB29045ULL,0xF30AB136CBB42560ULL,0x62019C0737122CFBULL,0xE86B930C13282FA1ULL,
-	0xCC1CEB542EE5374BULL,0x538FD28AA21B3A08ULL,0x1B61223AD89C0AC1ULL,0x36C24474AD25149FULL,
-	0x7A23D3E9F74C9D06ULL,0xBE21F6E79968C5EDULL,0xCF5F868036278C77ULL,0xF705D61BEB5A9C30ULL,
-	0x4D2B47D152DCE08DULL,0x5F9E7BFDC234ECF8ULL,0x247778583DCD18EAULL,0x867BA67C4415D5AAULL,
-	0x4CE1979D5A698999ULL,0x0000000000000000ULL,0xEC64F42133C696F1ULL,0xB57C5569C16B1171ULL,
-	0xC1C7926F467F88AFULL,0x654D96FE0F3E2E97ULL,0x15F936D5A8C40E19ULL,0xB8A72C52A9F1AE95ULL,
-	0xA9517DAA21DB19DCULL,0x58D27104FA18EE94ULL,0x5918A148F2AD8780ULL,0x5CDD1629DAF657C4ULL,
-	0x8274C15164FB6CFAULL,0xD1FB13DBC6E056F2ULL,0x7D6FD910CF609F6AULL,0xB63F38BDD9A9AA4DULL,
-	0x3D9FE7FAF526C003ULL,0x74BBC706871499DEULL,0xDF630734B6B8522AULL,0x3AD3ED03CD0AC26FULL,
-	0xFADEAF2083C023D4ULL,0xC00D42234ECAE1BBULL,0x8538CBA85CD76E96ULL,0xC402250E6E2458EBULL,
-	0x47BC3413026A5D05ULL,0xAFD7A71F114272A4ULL,0x978DF784CC3F62E3ULL,0xB96DFC1EA144C781ULL,
-	0x21B2CF391596C8AEULL,0x318E4E8D950916F3ULL,0xCE9556CC3E92E563ULL,0x385A509BDD7D1047ULL,
-	0x358129A0B5E7AFA3ULL,0xE6F387E363702B79ULL,0xE0755D5653E94001ULL,0x7BE903A5FFF9F412ULL,
-	0x12B53C2C90E80C75ULL,0x3307F315857EC4DBULL,0x8FAFB86A0C61D31EULL,0xD9E5DD8186213952ULL,
-	0x77F8AAD29FD622E2ULL,0x25BDA814357871FEULL,0x7571174A8FA1F0CAULL,0x137FEC60985D6561ULL,
-	0x30449EC19DBC7FE7ULL,0xA540D4DD41F4CF2CULL,0xDC206AE0AE7AE916ULL,0x5B911CD0E2DA55A8ULL,
-	0xB2305F90F947131DULL,0x344BF9ECBD52C6B7ULL,0x5D17C665D2433ED0ULL,0x18224FEEC05EB1FDULL,
-	0x9E59E992844B6457ULL,0x9A568EBFA4A5DD07ULL,0xA3C60E68716DA454ULL,0x7E2CB4C4D7A22456ULL,
-	0x87B176304CA0BCBEULL,0x413AEEA632F3367DULL,0x9915E36BBC67663BULL,0x40F03EEA3A465F69ULL,
-	0x1C2D28C3E0B008ADULL,0x4E682A054A1E5BB1ULL,0x05C5B761285BD044ULL,0xE1BF8D1A5B5C2915ULL,
-	0xF2C0617AC3014C74ULL,0xB7F5E8F1D11CC359ULL,0x63CB4C4B3FA745EFULL,0x9D1A84469C89DF6BULL,
-	0xE33630824B2BFB3DULL,0xD5F474F6E60EEFA2ULL,0xF58C6B83FB2D4E18ULL,0x4676E45F0ADF3411ULL,
-	0x20781F751D23A1BAULL,0xBD629B3381AA7ED1ULL,0xAE1D775319F71BB0ULL,0xFED1C80DA32E9A84ULL,
-	0x5509083F92825170ULL,0x29AC01635557A70EULL,0xA7C9694551831D04ULL,0x8E65682604D4BA0AULL,
-	0x11F651F8882AB749ULL,0xD77DC96EF6793D8AULL,0xEF2799F52B042DCDULL,0x48EEF0B07A8730C9ULL,
-	0x22F1A2ED0D547392ULL,0x6142F1D32FD097C7ULL,0x4A674D286AF0E2E1ULL,0x80FD7CC9748CBED2ULL,
-	0x717E7067AF4F499AULL,0x938290A9ECD1DBB3ULL,0x88E3B293344DD172ULL,0x2734158C250FA3D6ULL
-} };
-
-// Constant values for KeySchedule function
-static const u8 C[12][64]{
-{
-	0xB1,0x08,0x5B,0xDA,0x1E,0xCA,0xDA,0xE9,0xEB,0xCB,0x2F,0x81,0xC0,0x65,0x7C,0x1F,
-	0x2F,0x6A,0x76,0x43,0x2E,0x45,0xD0,0x16,0x71,0x4E,0xB8,0x8D,0x75,0x85,0xC4,0xFC,
-	0x4B,0x7C,0xE0,0x91,0x92,0x67,0x69,0x01,0xA2,0x42,0x2A,0x08,0xA4,0x60,0xD3,0x15,
-	0x05,0x76,0x74,0x36,0xCC,0x74,0x4D,0x23,0xDD,0x80,0x65,0x59,0xF2,0xA6,0x45,0x07
-},
-{
-	0x6F,0xA3,0xB5,0x8A,0xA9,0x9D,0x2F,0x1A,0x4F,0xE3,0x9D,0x46,0x0F,0x70,0xB5,0xD7,
-	0xF3,0xFE,0xEA,0x72,0x0A,0x23,0x2B,0x98,0x61,0xD5,0x5E,0x0F,0x16,0xB5,0x01,0x31,
-	0x9A,0xB5,0x17,0x6B,0x12,0xD6,0x99,0x58,0x5C,0xB5,0x61,0xC2,0xDB,0x0A,0xA7,0xCA,
-	0x55,0xDD,0xA2,0x1B,0xD7,0xCB,0xCD,0x56,0xE6,0x79,0x04,0x70,0x21,0xB1,0x9B,0xB7
-},
-{
-	0xF5,0x74,0xDC,0xAC,0x2B,0xCE,0x2F,0xC7,0x0A,0x39,0xFC,0x28,0x6A,0x3D,0x84,0x35,
-	0x06,0xF1,0x5E,0x5F,0x52,0x9C,0x1F,0x8B,0xF2,0xEA,0x75,0x14,0xB1,0x29,0x7B,0x7B,
-	0xD3,0xE2,0x0F,0xE4,0x90,0x35,0x9E,0xB1,0xC1,0xC9,0x3A,0x37,0x60,0x62,0xDB,0x09,
-	0xC2,0xB6,0xF4,0x43,0x86,0x7A,0xDB,0x31,0x99,0x1E,0x96,0xF5,0x0A,0xBA,0x0A,0xB2
-},
-{
-	0xEF,0x1F,0xDF,0xB3,0xE8,0x15,0x66,0xD2,0xF9,0x48,0xE1,0xA0,0x5D,0x71,0xE4,0xDD,
-	0x48,0x8E,0x85,0x7E,0x33,0x5C,0x3C,0x7D,0x9D,0x72,0x1C,0xAD,0x68,0x5E,0x35,0x3F,
-	0xA9,0xD7,0x2C,0x82,0xED,0x03,0xD6,0x75,0xD8,0xB7,0x13,0x33,0x93,0x52,0x03,0xBE,
-	0x34,0x53,0xEA,0xA1,0x93,0xE8,0x37,0xF1,0x22,0x0C,0xBE,0xBC,0x84,0xE3,0xD1,0x2E
-},
-{
-	0x4B,0xEA,0x6B,0xAC,0xAD,0x47,0x47,0x99,0x9A,0x3F,0x41,0x0C,0x6C,0xA9,0x23,0x63,
-	0x7F,0x15,0x1C,0x1F,0x16,0x86,0x10,0x4A,0x35,0x9E,0x35,0xD7,0x80,0x0F,0xFF,0xBD,
-	0xBF,0xCD,0x17,0x47,0x25,0x3A,0xF5,0xA3,0xDF,0xFF,0x00,0xB7,0x23,0x27,0x1A,0x16,
-	0x7A,0x56,0xA2,0x7E,0xA9,0xEA,0x63,0xF5,0x60,0x17,0x58,0xFD,0x7C,0x6C,0xFE,0x57
-},
-{
-	0xAE,0x4F,0xAE,0xAE,0x1D,0x3A,0xD3,0xD9,0x6F,0xA4,0xC3,0x3B,0x7A,0x30,0x39,0xC0,
-	0x2D,0x66,0xC4,0xF9,0x51,0x42,0xA4,0x6C,0x18,0x7F,0x9A,0xB4,0x9A,0xF0,0x8E,0xC6,
-	0xCF,0xFA,0xA6,0xB7,0x1C,0x9A,0xB7,0xB4,0x0A,0xF2,0x1F,0x66,0xC2,0xBE,0xC6,0xB6,
-	0xBF,0x71,0xC5,0x72,0x36,0x90,0x4F,0x35,0xFA,0x68,0x40,0x7A,0x46,0x64,0x7D,0x6E
-},
-{
-	0xF4,0xC7,0x0E,0x16,0xEE,0xAA,0xC5,0xEC,0x51,0xAC,0x86,0xFE,0xBF,0x24,0x09,0x54,
-	0x39,0x9E,0xC6,0xC7,0xE6,0xBF,0x87,0xC9,0xD3,0x47,0x3E,0x33,0x19,0x7A,0x93,0xC9,
-	0x09,0x92,0xAB,0xC5,0x2D,0x82,0x2C,0x37,0x06,0x47,0x69,0x83,0x28,0x4A,0x05,0x04,
-	0x35,0x17,0x45,0x4C,0xA2,0x3C,0x4A,0xF3,0x88,0x86,0x56,0x4D,0x3A,0x14,0xD4,0x93
-},
-{
-	0x9B,0x1F,0x5B,0x42,0x4D,0x93,0xC9,0xA7,0x03,0xE7,0xAA,0x02,0x0C,0x6E,0x41,0x41,
-	0x4E,0xB7,0xF8,0x71,0x9C,0x36,0xDE,0x1E,0x89,0xB4,0x44,0x3B,0x4D,0xDB,0xC4,0x9A,
-	0xF4,0x89,0x2B,0xCB,0x92,0x9B,0x06,0x90,0x69,0xD1,0x8D,0x2B,0xD1,0xA5,0xC4,0x2F,
-	0x36,0xAC,0xC2,0x35,0x59,0x51,0xA8,0xD9,0xA4,0x7F,0x0D,0xD4,0xBF,0x02,0xE7,0x1E
-},
-{
-	0x37,0x8F,0x5A,0x54,0x16,0x31,0x22,0x9B,0x94,0x4C,0x9A,0xD8,0xEC,0x16,0x5F,0xDE,
-	0x3A,0x7D,0x3A,0x1B,0x25,0x89,0x42,0x24,0x3C,0xD9,0x55,0xB7,0xE0,0x0D,0x09,0x84,
-	0x80,0x0A,0x44,0x0B,0xDB,0xB2,0xCE,0xB1,0x7B,0x2B,0x8A,0x9A,0xA6,0x07,0x9C,0x54,
-	0x0E,0x38,0xDC,0x92,0xCB,0x1F,0x2A,0x60,0x72,0x61,0x44,0x51,0x83,0x23,0x5A,0xDB
-},
-{
-	0xAB,0xBE,0xDE,0xA6,0x80,0x05,0x6F,0x52,0x38,0x2A,0xE5,0x48,0xB2,0xE4,0xF3,0xF3,
-	0x89,0x41,0xE7,0x1C,0xFF,0x8A,0x78,0xDB,0x1F,0xFF,0xE1,0x8A,0x1B,0x33,0x61,0x03,
-	0x9F,0xE7,0x67,0x02,0xAF,0x69,0x33,0x4B,0x7A,0x1E,0x6C,0x30,0x3B,0x76,0x52,0xF4,
-	0x36,0x98,0xFA,0xD1,0x15,0x3B,0xB6,0xC3,0x74,0xB4,0xC7,0xFB,0x98,0x45,0x9C,0xED
-},
-{
-	0x7B,0xCD,0x9E,0xD0,0xEF,0xC8,0x89,0xFB,0x30,0x02,0xC6,0xCD,0x63,0x5A,0xFE,0x94,
-	0xD8,0xFA,0x6B,0xBB,0xEB,0xAB,0x07,0x61,0x20,0x01,0x80,0x21,0x14,0x84,0x66,0x79,
-	0x8A,0x1D,0x71,0xEF,0xEA,0x48,0xB9,0xCA,0xEF,0xBA,0xCD,0x1D,0x7D,0x47,0x6E,0x98,
-	0xDE,0xA2,0x59,0x4A,0xC0,0x6F,0xD8,0x5D,0x6B,0xCA,0xA4,0xCD,0x81,0xF3,0x2D,0x1B
-},
-{
-	0x37,0x8E,0xE7,0x67,0xF1,0x16,0x31,0xBA,0xD2,0x13,0x80,0xB0,0x04,0x49,0xB1,0x7A,
-	0xCD,0xA4,0x3C,0x32,0xBC,0xDF,0x1D,0x77,0xF8,0x20,0x12,0xD4,0x30,0x21,0x9F,0x9B,
-	0x5D,0x80,0xEF,0x9D,0x18,0x91,0xCC,0x86,0xE7,0x1D,0xA4,0xAA,0x88,0xE1,0x28,0x52,
-	0xFA,0xF4,0x17,0xD5,0xD9,0xB2,0x1B,0x99,0x48,0xBC,0x92,0x4A,0xF1,0x1B,0xD7,0x20
-} };
-
-
-static void AddModulo512(const void* a, const void* b, void* c)
-{
-	const u8* A = (u8*)a, * B = (u8*)b;
-	u8* C = (u8*)c;
-
-	int t = 0;
-#ifdef FULL_UNROLL
-#define ADDBYTE_8(i) t = A[i] + B[i] + (t >> 8); C[i] = t & 0xFF;
-
-	ADDBYTE_8(63)
-		ADDBYTE_8(62)
-		ADDBYTE_8(61)
-		ADDBYTE_8(60)
-		ADDBYTE_8(59)
-		ADDBYTE_8(58)
-		ADDBYTE_8(57)
-		ADDBYTE_8(56)
-		ADDBYTE_8(55)
-		ADDBYTE_8(54)
-		ADDBYTE_8(53)
-		ADDBYTE_8(52)
-		ADDBYTE_8(51)
-		ADDBYTE_8(50)
-		ADDBYTE_8(49)
-		ADDBYTE_8(48)
-		ADDBYTE_8(47)
-		ADDBYTE_8(46)
-		ADDBYTE_8(45)
-		ADDBYTE_8(44)
-		ADDBYTE_8(43)
-		ADDBYTE_8(42)
-		ADDBYTE_8(41)
-		ADDBYTE_8(40)
-		ADDBYTE_8(39)
-		ADDBYTE_8(38)
-		ADDBYTE_8(37)
-		ADDBYTE_8(36)
-		ADDBYTE_8(35)
-		ADDBYTE_8(34)
-		ADDBYTE_8(33)
-		ADDBYTE_8(32)
-		ADDBYTE_8(31)
-		ADDBYTE_8(30)
-		ADDBYTE_8(29)
-		ADDBYTE_8(28)
-		ADDBYTE_8(27)
-		ADDBYTE_8(26)
-		ADDBYTE_8(25)
-		ADDBYTE_8(24)
-		ADDBYTE_8(23)
-		ADDBYTE_8(22)
-		ADDBYTE_8(21)
-		ADDBYTE_8(20)
-		ADDBYTE_8(19)
-		ADDBYTE_8(18)
-		ADDBYTE_8(17)
-		ADDBYTE_8(16)
-		ADDBYTE_8(15)
-		ADDBYTE_8(14)
-		ADDBYTE_8(13)
-		ADDBYTE_8(12)
-		ADDBYTE_8(11)
-		ADDBYTE_8(10)
-		ADDBYTE_8(9)
-		ADDBYTE_8(8)
-		ADDBYTE_8(7)
-		ADDBYTE_8(6)
-		ADDBYTE_8(5)
-		ADDBYTE_8(4)
-		ADDBYTE_8(3)
-		ADDBYTE_8(2)
-		ADDBYTE_8(1)
-		ADDBYTE_8(0)
+using streebog::Ax;
+using streebog::C;
 
+template<size_t size>
+static constexpr bool equalsHex(const std::array<byte, size>& bytes, const char* hex)
+{
+	const auto nibble = [](char c) { return c <= '9' ? c - '0' : c - 'a' + 10; };
+
+	for (size_t i = 0; i < size; ++i) {
+		if (bytes[i] != (nibble(hex[2 * i]) << 4 | nibble(hex[2 * i + 1]))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// The compiler checks the tables and the scalar core with the first example of RFC 6986,
+// the message and the digests being the byte strings update() and final() deal with
+static_assert(equalsHex(constHash("012345678901234567890123456789012345678901234567890123456789012"),
+                        "1b54d01a4af5b9d5cc3d86d68d285462b19abc2475222f35c085122be4ba1ffa"
+                        "00ad30f8767b3a82384c6574f024c311e2a481332b08ef7f41797891c1646f48"));
+static_assert(equalsHex(constHash<32>("012345678901234567890123456789012345678901234567890123456789012"),
+                        "9d151eefd8590b89daa6ba6cb74af9275dd051026bb149a452fd84e5e57b5500"));
+
+// The engine keeps h, N, Sigma and the message block as eight words of the little-endian
+// number, word 0 being the lowest. hash() and finalHead() read big-endian numbers
+// and turn them around on the way in and out
+
+static inline u64 load64(const byte* src)
+{
+	u64 w;
+	memcpy(&w, src, 8);
+	return w;
+}
+
+// words of a block given as a big-endian number
+static inline void loadBigEndian(u64* m, const byte* src)
+{
+	for (int j = 0; j < 8; ++j) {
+		m[j] = bswap64(load64(src + 56 - 8 * j));
+	}
+}
+
+// streebog::add512() on the carry flag
+static inline void add512(u64* a, const u64* b)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	unsigned char carry = 0;
+	for (int i = 0; i < 8; ++i) {
+		carry = _addcarry_u64(carry, a[i], b[i], reinterpret_cast<unsigned long long*>(&a[i]));
+	}
 #else
-	for (int i = 63; i >= 0; --i)
-	{
-		t = A[i] + B[i] + (t >> 8);
-		C[i] = t & 0xFF;
+	streebog::add512(a, b);
+#endif
+}
+
+using streebog::addLength;
+using streebog::lps;
+
+#ifdef GOST_X86
+// Ax[k] rows of a 512-bit value held one word per 64-bit lane: input word k is spread
+// over all the lanes, lane i takes its byte i, and the eight indices go to a single gather
+GOST_TARGET("avx512f")
+static inline __m512i gatherAvx512(__m512i x, int k)
+{
+	const __m512i shifts = _mm512_setr_epi64(0, 8, 16, 24, 32, 40, 48, 56);
+	const __m512i mask = _mm512_set1_epi64(0xFF);
+
+	const __m512i word = _mm512_permutexvar_epi64(_mm512_set1_epi64(k), x);
+	return _mm512_i64gather_epi64(_mm512_and_si512(_mm512_srlv_epi64(word, shifts), mask), Ax[k], 8);
+}
+
+GOST_TARGET("avx512f")
+static inline __m512i lpsAvx512(__m512i x)
+{
+	__m512i r = _mm512_setzero_si512();
+	for (int k = 0; k < 8; ++k) {
+		r = _mm512_xor_si512(r, gatherAvx512(x, k));
+	}
+	return r;
+}
+
+// LPS of the state and the key of a round, their gathers interleaved
+GOST_TARGET("avx512f")
+static inline void lpsPairAvx512(__m512i& x, __m512i& y)
+{
+	__m512i rx = _mm512_setzero_si512();
+	__m512i ry = _mm512_setzero_si512();
+
+	for (int k = 0; k < 8; ++k) {
+		rx = _mm512_xor_si512(rx, gatherAvx512(x, k));
+		ry = _mm512_xor_si512(ry, gatherAvx512(y, k));
 	}
+
+	x = rx;
+	y = ry;
+}
+
+// g_N() with h, the key and the state in zmm registers, the state and key LPS of a round together
+GOST_TARGET("avx512f")
+static void g_NAvx512(const u64* N, u64* h, const u64* m)
+{
+	const __m512i H = _mm512_loadu_si512(h);
+	const __m512i M = _mm512_loadu_si512(m);
+
+	__m512i K = lpsAvx512(_mm512_xor_si512(H, _mm512_loadu_si512(N)));
+	__m512i state = _mm512_xor_si512(M, K);
+
+	for (int round = 0; round < 12; ++round) {
+		K = _mm512_xor_si512(K, _mm512_loadu_si512(C[round]));
+		lpsPairAvx512(state, K);
+		state = _mm512_xor_si512(state, K);
+	}
+
+	_mm512_storeu_si512(h, _mm512_xor_si512(_mm512_xor_si512(state, H), M));
+}
 #endif
+
+// streebog::g() in zmm registers when the CPU has them. A single message gets no AVX2 kernel,
+// its four-lane gathers are slower than the scalar lookups
+static void g_N(const u64* N, u64* h, const u64* m)
+{
+#ifdef GOST_X86
+	if (cpu::hasAvx512()) {
+		g_NAvx512(N, h, m);
+		return;
+	}
+#endif
+
+	streebog::g(N, h, m);
 }
 
-static void AddXor512(const void* a, const void* b, void* c)
+// Round keys of E for one h and N: K[0] = LPS(h ^ N), K[r + 1] = LPS(K[r] ^ C[r]).
+// They are half of the work of g_N(), and the same for every message at the same h and N
+struct KeySchedule
 {
-	const u64* A = (u64*)a, * B = (u64*)b;
-	u64* C = (u64*)c;
+	u64 K[13][8];
 
-#ifdef FULL_UNROLL
-	C[0] = A[0] ^ B[0];
-	C[1] = A[1] ^ B[1];
-	C[2] = A[2] ^ B[2];
-	C[3] = A[3] ^ B[3];
-	C[4] = A[4] ^ B[4];
-	C[5] = A[5] ^ B[5];
-	C[6] = A[6] ^ B[6];
-	C[7] = A[7] ^ B[7];
-#else
-	for (uint i = 0; i < 8; ++i)
-	{
-		C[i] = A[i] ^ B[i];
+	~KeySchedule() { memwipe(K, sizeof(K)); }
+};
+
+static void expandKeys(KeySchedule& s, const u64* N, const u64* h)
+{
+	u64 t[8];
+
+	for (int i = 0; i < 8; ++i) {
+		t[i] = h[i] ^ N[i];
+	}
+	lps(s.K[0], t);
+
+	for (int round = 0; round < 12; ++round) {
+		for (int i = 0; i < 8; ++i) {
+			t[i] = s.K[round][i] ^ C[round][i];
+		}
+		lps(s.K[round + 1], t);
+	}
+
+	memwipe(t, sizeof(t));
+}
+
+// the round keys of the first block of a message, h being the IV and N zero
+static const std::shared_ptr<const KeySchedule>& ivSchedule(size_t digestSize)
+{
+	static const auto make = [](u64 iv) {
+		const u64 N[8] = {};
+		u64 h[8];
+		std::fill(h, h + 8, iv);
+
+		auto s = std::make_shared<KeySchedule>();
+		expandKeys(*s, N, h);
+		return std::shared_ptr<const KeySchedule>(std::move(s));
+	};
+
+	static const std::shared_ptr<const KeySchedule> schedule512 = make(0);
+	static const std::shared_ptr<const KeySchedule> schedule256 = make(0x0101010101010101ULL);
+
+	return digestSize == 64 ? schedule512 : schedule256;
+}
+
+#ifdef GOST_X86
+GOST_TARGET("avx512f")
+static void g_NKeyedAvx512(const KeySchedule& s, u64* h, const u64* m)
+{
+	const __m512i H = _mm512_loadu_si512(h);
+	const __m512i M = _mm512_loadu_si512(m);
+
+	__m512i state = _mm512_xor_si512(M, _mm512_loadu_si512(s.K[0]));
+	for (int round = 0; round < 12; ++round) {
+		state = _mm512_xor_si512(lpsAvx512(state), _mm512_loadu_si512(s.K[round + 1]));
+	}
+
+	_mm512_storeu_si512(h, _mm512_xor_si512(_mm512_xor_si512(state, H), M));
+}
+#endif
+
+// g_N() with the round keys given, only the state half of every round is left
+static void g_NKeyed(const KeySchedule& s, u64* h, const u64* m)
+{
+#ifdef GOST_X86
+	if (cpu::hasAvx512()) {
+		g_NKeyedAvx512(s, h, m);
+		return;
 	}
 #endif
+
+	u64 state[8];
+	u64 t[8];
+
+	for (int i = 0; i < 8; ++i) {
+		t[i] = m[i] ^ s.K[0][i];
+	}
+
+	for (int round = 0; round < 12; ++round) {
+		lps(state, t);
+
+		for (int i = 0; i < 8; ++i) {
+			t[i] = state[i] ^ s.K[round + 1][i];
+		}
+	}
+
+	for (int i = 0; i < 8; ++i) {
+		h[i] ^= t[i] ^ m[i];
+	}
+
+	memwipe(state, sizeof(state));
+	memwipe(t, sizeof(t));
 }
 
-static void F(u8* state)
-{
-	u64 return_state[8];
-	u64 r = 0;
-
-	r ^= T[0][state[56]];
-	r ^= T[1][state[48]];
-	r ^= T[2][state[40]];
-	r ^= T[3][state[32]];
-	r ^= T[4][state[24]];
-	r ^= T[5][state[16]];
-	r ^= T[6][state[8]];
-	r ^= T[7][state[0]];
-	return_state[0] = r;
-	r = 0;
-
-	r ^= T[0][state[57]];
-	r ^= T[1][state[49]];
-	r ^= T[2][state[41]];
-	r ^= T[3][state[33]];
-	r ^= T[4][state[25]];
-	r ^= T[5][state[17]];
-	r ^= T[6][state[9]];
-	r ^= T[7][state[1]];
-	return_state[1] = r;
-	r = 0;
-
-	r ^= T[0][state[58]];
-	r ^= T[1][state[50]];
-	r ^= T[2][state[42]];
-	r ^= T[3][state[34]];
-	r ^= T[4][state[26]];
-	r ^= T[5][state[18]];
-	r ^= T[6][state[10]];
-	r ^= T[7][state[2]];
-	return_state[2] = r;
-	r = 0;
-
-	r ^= T[0][state[59]];
-	r ^= T[1][state[51]];
-	r ^= T[2][state[43]];
-	r ^= T[3][state[35]];
-	r ^= T[4][state[27]];
-	r ^= T[5][state[19]];
-	r ^= T[6][state[11]];
-	r ^= T[7][state[3]];
-	return_state[3] = r;
-	r = 0;
-
-	r ^= T[0][state[60]];
-	r ^= T[1][state[52]];
-	r ^= T[2][state[44]];
-	r ^= T[3][state[36]];
-	r ^= T[4][state[28]];
-	r ^= T[5][state[20]];
-	r ^= T[6][state[12]];
-	r ^= T[7][state[4]];
-	return_state[4] = r;
-	r = 0;
-
-	r ^= T[0][state[61]];
-	r ^= T[1][state[53]];
-	r ^= T[2][state[45]];
-	r ^= T[3][state[37]];
-	r ^= T[4][state[29]];
-	r ^= T[5][state[21]];
-	r ^= T[6][state[13]];
-	r ^= T[7][state[5]];
-	return_state[5] = r;
-	r = 0;
-
-	r ^= T[0][state[62]];
-	r ^= T[1][state[54]];
-	r ^= T[2][state[46]];
-	r ^= T[3][state[38]];
-	r ^= T[4][state[30]];
-	r ^= T[5][state[22]];
-	r ^= T[6][state[14]];
-	r ^= T[7][state[6]];
-	return_state[6] = r;
-	r = 0;
-
-	r ^= T[0][state[63]];
-	r ^= T[1][state[55]];
-	r ^= T[2][state[47]];
-	r ^= T[3][state[39]];
-	r ^= T[4][state[31]];
-	r ^= T[5][state[23]];
-	r ^= T[6][state[15]];
-	r ^= T[7][state[7]];
-	return_state[7] = r;
-
-	memcpy(state, (u8*)return_state, 64);
-}
-
-#define KeySchedule(K, i) AddXor512(K, C[i], K); F(K);
-
-static void E(u8* K, const u8* m, u8* state)
-{
-#ifdef FULL_UNROLL
-	AddXor512(m, K, state);
-
-	F(state);
-	KeySchedule(K, 0);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 1);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 2);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 3);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 4);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 5);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 6);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 7);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 8);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 9);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 10);
-	AddXor512(state, K, state);
-
-	F(state);
-	KeySchedule(K, 11);
-	AddXor512(state, K, state);
-#else
+// Multi-buffer form of g_N(): one independent message per SIMD lane, the values laid out word by word,
+// x[i][lane] being word i of the lane. Scalar code gains nothing from this, it is bound by the lookups
+// and not by their latency, so without AVX-512 hashMany() takes the messages one by one
+constexpr size_t MAX_LANES = 8;
 
-	AddXor512(m, K, state);
+using LaneWords = u64[8][MAX_LANES];
 
-	for (uint i = 0; i < 12; ++i)
-	{
-		F(state);
-		KeySchedule(K, i);
-		AddXor512(state, K, state);
+#ifdef GOST_X86
+// With the words of eight lanes in a register, byte i of word k is a plain shift
+// and every output word is eight gathers
+GOST_TARGET("avx512f")
+static inline void lpsLanesAvx512(__m512i* r, const __m512i* x)
+{
+	const __m512i mask = _mm512_set1_epi64(0xFF);
+
+	for (int i = 0; i < 8; ++i) {
+		const __m128i shift = _mm_cvtsi32_si128(i * 8);
+
+		__m512i acc = _mm512_setzero_si512();
+		for (int k = 0; k < 8; ++k) {
+			acc = _mm512_xor_si512(acc, _mm512_i64gather_epi64(_mm512_and_si512(_mm512_srl_epi64(x[k], shift), mask), Ax[k], 8));
+		}
+		r[i] = acc;
+	}
+}
+
+GOST_TARGET("avx512f")
+static void g_NLanesAvx512(const LaneWords& N, LaneWords& h, const LaneWords& m)
+{
+	__m512i H[8];
+	__m512i M[8];
+	__m512i K[8];
+	__m512i state[8];
+	__m512i t[8];
+	__m512i kc[8];
+
+	for (int i = 0; i < 8; ++i) {
+		H[i] = _mm512_loadu_si512(h[i]);
+		M[i] = _mm512_loadu_si512(m[i]);
+		t[i] = _mm512_xor_si512(H[i], _mm512_loadu_si512(N[i]));
+	}
+	lpsLanesAvx512(K, t);
+
+	for (int i = 0; i < 8; ++i) {
+		t[i] = _mm512_xor_si512(M[i], K[i]);
+	}
+
+	for (int round = 0; round < 12; ++round) {
+		for (int i = 0; i < 8; ++i) {
+			kc[i] = _mm512_xor_si512(K[i], _mm512_set1_epi64(static_cast<long long>(C[round][i])));
+		}
+		lpsLanesAvx512(state, t);
+		lpsLanesAvx512(K, kc);
+
+		for (int i = 0; i < 8; ++i) {
+			t[i] = _mm512_xor_si512(state[i], K[i]);
+		}
+	}
+
+	for (int i = 0; i < 8; ++i) {
+		_mm512_storeu_si512(h[i], _mm512_xor_si512(_mm512_xor_si512(t[i], H[i]), M[i]));
+	}
+}
+#endif
+
+// Lanes need AVX-512. Four AVX2 lanes take as long as four messages one by one
+static size_t laneCount()
+{
+#ifdef GOST_X86
+	if (cpu::hasAvx512()) {
+		return 8;
+	}
+#endif
+	return 0;
+}
+
+// only called when laneCount() is not 0
+static void g_NLanes(const LaneWords& N, LaneWords& h, const LaneWords& m)
+{
+#ifdef GOST_X86
+	g_NLanesAvx512(N, h, m);
+#endif
+}
+
+// Round keys of a group of lanes, keys[r][i][lane] being word i of round key r of the lane.
+// Returns false, when one of the lanes has none
+static bool laneKeys(const KeySchedule* const* schedules, size_t count, LaneWords* keys)
+{
+	for (size_t l = 0; l < count; ++l) {
+		if (!schedules[l]) {
+			return false;
+		}
+	}
+
+	for (int r = 0; r < 13; ++r) {
+		for (int i = 0; i < 8; ++i) {
+			for (size_t l = 0; l < count; ++l) {
+				keys[r][i][l] = schedules[l]->K[r][i];
+			}
+		}
+	}
+
+	return true;
+}
+
+#ifdef GOST_X86
+GOST_TARGET("avx512f")
+static void g_NLanesKeyedAvx512(const LaneWords* keys, LaneWords& h, const LaneWords& m)
+{
+	__m512i H[8];
+	__m512i M[8];
+	__m512i state[8];
+	__m512i t[8];
+
+	for (int i = 0; i < 8; ++i) {
+		H[i] = _mm512_loadu_si512(h[i]);
+		M[i] = _mm512_loadu_si512(m[i]);
+		t[i] = _mm512_xor_si512(M[i], _mm512_loadu_si512(keys[0][i]));
+	}
+
+	for (int round = 0; round < 12; ++round) {
+		lpsLanesAvx512(state, t);
+
+		for (int i = 0; i < 8; ++i) {
+			t[i] = _mm512_xor_si512(state[i], _mm512_loadu_si512(keys[round + 1][i]));
+		}
 	}
+
+	for (int i = 0; i < 8; ++i) {
+		_mm512_storeu_si512(h[i], _mm512_xor_si512(_mm512_xor_si512(t[i], H[i]), M[i]));
+	}
+}
+#endif
+
+// g_NLanes() with the round keys of laneKeys()
+static void g_NLanesKeyed(const LaneWords* keys, LaneWords& h, const LaneWords& m)
+{
+#ifdef GOST_X86
+	g_NLanesKeyedAvx512(keys, h, m);
 #endif
 }
 
-static void g_N(const u8* N, u8* h, const u8* m)
+// A constructor has no result to report a bad size with, and running on would make up a digest or write past it
+static size_t checkedDigestSize(size_t digestSize)
+{
+	if (digestSize != 64 && digestSize != 32) {
+		throw std::invalid_argument("Streebog digests are 64 or 32 bytes");
+	}
+	return digestSize;
+}
+
+Hasher::Hasher(size_t digestSize)
+	: digestSize(checkedDigestSize(digestSize))
 {
-	u8 t[64], K[64];
+	init();
+}
+
+Hasher::~Hasher()
+{
+	memwipe(h, sizeof(h));
+	memwipe(N, sizeof(N));
+	memwipe(Sigma, sizeof(Sigma));
+	memwipe(buffer, sizeof(buffer));
+}
+
+void Hasher::init()
+{
+	// IV is 0^512 for the 512-bit digest and (00000001)^64 for the 256-bit one
+	const u64 iv = digestSize == 64 ? 0 : 0x0101010101010101ULL;
+
+	for (int i = 0; i < 8; ++i) {
+		h[i] = iv;
+		N[i] = 0;
+		Sigma[i] = 0;
+	}
+
+	memset(buffer, 0, 64);
+	buffered = 0;
+	schedule = ivSchedule(digestSize);
+}
 
-	AddXor512(N, h, K);
-	F(K);
-	E(K, m, t);
-	AddXor512(t, h, t);
-	AddXor512(t, m, h);
+void Hasher::prepare()
+{
+	if (!schedule) {
+		auto s = std::make_shared<KeySchedule>();
+		expandKeys(*s, N, h);
+		schedule = std::move(s);
+	}
 }
 
 void Hasher::hash(const byte* src, byte* hash, size_t srcLength)
 {
-	u8 v512[64] = { 0 };
-	u8 v0[64] = { 0 };
-	u8 Sigma[64] = { 0 };
-	u8 N[64] = { 0 };
-	u8 m[64];
-	u64 len = srcLength * 8;
+	Hasher().finalHead(src, srcLength, hash);
+}
+
+void Hasher::hash256(const byte* src, byte* hash, size_t srcLength)
+{
+	Hasher(32).finalHead(src, srcLength, hash);
+}
 
-	memset(hash, 0, 64);
-	v512[62] = 0x02;
+// Every message of hashMany() on one thread
+static void hashLanes(const byte* const* srcs, const size_t* sizes, byte* const* hashes, size_t n, size_t digestSize)
+{
+	// Every lane runs the g_N() calls of hash() for its message one by one: the full blocks from
+	// the end, the padded head, then N and Sigma. A lane that is done takes the next message
+	enum Stage { BLOCKS, HEAD, LENGTH, SUM };
 
-	// Stage 2
-	while (len >= 512)
+	struct Job
 	{
-		memcpy(m, src + len / 8 - 63 - ((len & 0x7) == 0), 64);
+		size_t message;
+		const byte* tail; // end of what is left of the message
+		Stage stage;
+		bool fresh; // before the first block, where the round keys are those of the IV
+		u64 N[8];
+		u64 Sigma[8];
+	};
+
+	const size_t lanes = laneCount();
+	if (lanes == 0) {
+		for (size_t i = 0; i < n; ++i) {
+			Hasher(digestSize).finalHead(srcs[i], sizes[i], hashes[i]);
+		}
+		return;
+	}
+
+	const u64 iv = digestSize == 64 ? 0 : 0x0101010101010101ULL;
 
-		g_N(N, hash, m);
-		AddModulo512(N, v512, N);
-		AddModulo512(Sigma, m, Sigma);
-		len -= 512;
+	alignas(64) LaneWords h = {};
+	alignas(64) LaneWords key = {};
+	alignas(64) LaneWords m = {};
+	alignas(64) LaneWords ivKeys[13];
+	Job jobs[MAX_LANES];
+	bool active[MAX_LANES] = {};
+	u64 block[8];
+	size_t next = 0;
+
+	const auto start = [&](size_t l) {
+		active[l] = next < n;
+		if (!active[l]) {
+			return;
+		}
+
+		jobs[l] = { next, srcs[next] + sizes[next], BLOCKS, true, {}, {} };
+		for (int i = 0; i < 8; ++i) {
+			h[i][l] = iv;
+		}
+		++next;
+	};
+
+	for (size_t l = 0; l < lanes; ++l) {
+		start(l);
 	}
 
-	memset(m, 0, 64);
-	memcpy(m + 63 - len / 8 + ((len & 0x7) == 0), src, (uint)(len / 8 + 1 - ((len & 0x7) == 0)));
+	// messages of the same length go through their first blocks together, those steps take the keys of the IV
+	const KeySchedule* ivSchedules[MAX_LANES];
+	std::fill(ivSchedules, ivSchedules + lanes, ivSchedule(digestSize).get());
+	laneKeys(ivSchedules, lanes, ivKeys);
+
+	while (std::any_of(active, active + lanes, [](bool a) { return a; })) {
+		bool allFresh = true;
+
+		for (size_t l = 0; l < lanes; ++l) {
+			if (!active[l]) {
+				continue;
+			}
+
+			Job& job = jobs[l];
+			const byte* src = srcs[job.message];
+
+			if (job.stage == BLOCKS && job.tail - src < 64) {
+				job.stage = HEAD;
+			}
+
+			switch (job.stage) {
+			case BLOCKS:
+				job.tail -= 64;
+				loadBigEndian(block, job.tail);
+				break;
+			case HEAD: {
+				const size_t head = job.tail - src;
+				u8 padded[64] = { 0 };
+				memcpy(padded + 64 - head, src, head);
+				padded[63 - head] |= 1;
+				loadBigEndian(block, padded);
+				memwipe(padded, sizeof(padded));
+				break;
+			}
+			case LENGTH:
+				memcpy(block, job.N, 64);
+				break;
+			case SUM:
+				memcpy(block, job.Sigma, 64);
+				break;
+			}
+
+			const bool keyed = job.stage == BLOCKS || job.stage == HEAD;
+			for (int i = 0; i < 8; ++i) {
+				key[i][l] = keyed ? job.N[i] : 0;
+				m[i][l] = block[i];
+			}
+
+			allFresh &= job.fresh;
+			job.fresh = false;
+		}
 
-	// Stage 3
-	m[63 - len / 8] |= (1 << (len & 0x7));
+		if (allFresh) {
+			g_NLanesKeyed(ivKeys, h, m);
+		}
+		else {
+			g_NLanes(key, h, m);
+		}
+
+		for (size_t l = 0; l < lanes; ++l) {
+			if (!active[l]) {
+				continue;
+			}
+
+			Job& job = jobs[l];
+
+			for (int i = 0; i < 8; ++i) {
+				block[i] = m[i][l];
+			}
+
+			switch (job.stage) {
+			case BLOCKS:
+				addLength(job.N, 512);
+				add512(job.Sigma, block);
+				break;
+			case HEAD:
+				addLength(job.N, (job.tail - srcs[job.message]) * 8);
+				add512(job.Sigma, block);
+				job.stage = LENGTH;
+				break;
+			case LENGTH:
+				job.stage = SUM;
+				break;
+			case SUM:
+				for (size_t j = 0; j < digestSize / 8; ++j) {
+					const u64 w = bswap64(h[7 - j][l]);
+					memcpy(hashes[job.message] + 8 * j, &w, 8);
+				}
+				start(l);
+				break;
+			}
+		}
+	}
+
+	memwipe(h, sizeof(h));
+	memwipe(key, sizeof(key));
+	memwipe(m, sizeof(m));
+	memwipe(jobs, sizeof(jobs));
+	memwipe(block, sizeof(block));
+}
+
+bool Hasher::hashMany(const byte* const* srcs, const size_t* sizes, byte* const* hashes, size_t n, size_t digestSize)
+{
+	if (digestSize != 64 && digestSize != 32) {
+		return false;
+	}
+
+	// chunks long enough to keep the lanes filled, one thread each
+	constexpr size_t CHUNK = 64 * MAX_LANES;
+
+	parallelFor((n + CHUNK - 1) / CHUNK, [&](size_t c) {
+		const size_t first = c * CHUNK;
+		hashLanes(srcs + first, sizes + first, hashes + first, std::min(CHUNK, n - first), digestSize);
+	});
+
+	return true;
+}
+
+void Hasher::updateMany(Hasher* const* hashers, const byte* const* blocks, size_t n)
+{
+	const size_t lanes = laneCount();
+	size_t first = 0;
+
+	// a single hasher is faster on its own
+	if (lanes != 0 && n > 1) {
+		alignas(64) LaneWords h = {};
+		alignas(64) LaneWords N = {};
+		alignas(64) LaneWords m = {};
+		alignas(64) LaneWords keys[13] = {};
+		const KeySchedule* schedules[MAX_LANES];
+
+		for (; first + 1 < n; first += lanes) {
+			const size_t count = std::min(lanes, n - first);
+
+			for (size_t l = 0; l < count; ++l) {
+				const Hasher& x = *hashers[first + l];
+				for (int i = 0; i < 8; ++i) {
+					h[i][l] = x.h[i];
+					N[i][l] = x.N[i];
+					m[i][l] = load64(blocks[first + l] + 8 * i);
+				}
+				schedules[l] = x.schedule.get();
+			}
+
+			// prepared states skip the key half, but only when the whole group has them
+			if (laneKeys(schedules, count, keys)) {
+				g_NLanesKeyed(keys, h, m);
+			}
+			else {
+				g_NLanes(N, h, m);
+			}
+
+			for (size_t l = 0; l < count; ++l) {
+				Hasher& x = *hashers[first + l];
+				u64 block[8];
+				for (int i = 0; i < 8; ++i) {
+					x.h[i] = h[i][l];
+					block[i] = m[i][l];
+				}
+				addLength(x.N, 512);
+				add512(x.Sigma, block);
+				x.schedule.reset();
+				memwipe(block, sizeof(block));
+			}
+		}
+
+		memwipe(h, sizeof(h));
+		memwipe(m, sizeof(m));
+		memwipe(keys, sizeof(keys));
+	}
+
+	for (; first < n; ++first) {
+		hashers[first]->update(blocks[first], 64);
+	}
+}
+
+void Hasher::finalMany(Hasher* const* hashers, byte* const* hashes, size_t n)
+{
+	const size_t lanes = laneCount();
+	size_t first = 0;
+
+	if (lanes != 0 && n > 1) {
+		alignas(64) LaneWords h = {};
+		alignas(64) LaneWords key = {};
+		alignas(64) LaneWords m = {};
+		alignas(64) LaneWords keys[13] = {};
+		const KeySchedule* schedules[MAX_LANES];
+		const LaneWords zero = {};
+
+		for (; first + 1 < n; first += lanes) {
+			const size_t count = std::min(lanes, n - first);
+
+			// the padded partial block, as in final()
+			for (size_t l = 0; l < count; ++l) {
+				Hasher& x = *hashers[first + l];
+				memset(x.buffer + x.buffered, 0, 64 - x.buffered);
+				x.buffer[x.buffered] = 1;
+
+				for (int i = 0; i < 8; ++i) {
+					h[i][l] = x.h[i];
+					key[i][l] = x.N[i];
+					m[i][l] = load64(x.buffer + 8 * i);
+				}
+				schedules[l] = x.schedule.get();
+
+				u64 block[8];
+				memcpy(block, x.buffer, 64);
+				addLength(x.N, x.buffered * 8);
+				add512(x.Sigma, block);
+				memwipe(block, sizeof(block));
+			}
+
+			if (laneKeys(schedules, count, keys)) {
+				g_NLanesKeyed(keys, h, m);
+			}
+			else {
+				g_NLanes(key, h, m);
+			}
+
+			// then N and Sigma
+			for (size_t l = 0; l < count; ++l) {
+				for (int i = 0; i < 8; ++i) {
+					m[i][l] = hashers[first + l]->N[i];
+				}
+			}
+			g_NLanes(zero, h, m);
+
+			for (size_t l = 0; l < count; ++l) {
+				for (int i = 0; i < 8; ++i) {
+					m[i][l] = hashers[first + l]->Sigma[i];
+				}
+			}
+			g_NLanes(zero, h, m);
+
+			for (size_t l = 0; l < count; ++l) {
+				Hasher& x = *hashers[first + l];
+				for (int i = 0; i < 8; ++i) {
+					x.h[i] = h[i][l];
+				}
+
+				memcpy(hashes[first + l], reinterpret_cast<const byte*>(x.h) + 64 - x.digestSize, x.digestSize);
+				x.init();
+			}
+		}
+
+		memwipe(h, sizeof(h));
+		memwipe(m, sizeof(m));
+		memwipe(keys, sizeof(keys));
+	}
+
+	for (; first < n; ++first) {
+		hashers[first]->final(hashes[first]);
+	}
+}
+
+void Hasher::finalTails(const byte* const* tails, const size_t* sizes, byte* const* hashes, size_t n) const
+{
+	// a few lane widths at a time, so the forks stay in cache
+	constexpr size_t CHUNK = 4 * MAX_LANES;
+
+	Hasher forks[CHUNK];
+	Hasher* active[CHUNK];
+	const byte* blocks[CHUNK];
+	size_t offsets[CHUNK];
+
+	for (size_t first = 0; first < n; first += CHUNK) {
+		const size_t count = std::min(CHUNK, n - first);
+		const byte* const* chunkTails = tails + first;
+		const size_t* chunkSizes = sizes + first;
+
+		// complete the partial block of the prefix, then take whole blocks of the tails in lockstep
+		for (size_t i = 0; i < count; ++i) {
+			forks[i] = *this;
+			offsets[i] = std::min(chunkSizes[i], (64 - buffered) % 64);
+			forks[i].update(chunkTails[i], offsets[i]);
+		}
+
+		for (;;) {
+			size_t k = 0;
+			for (size_t i = 0; i < count; ++i) {
+				if (chunkSizes[i] - offsets[i] >= 64) {
+					active[k] = &forks[i];
+					blocks[k++] = chunkTails[i] + offsets[i];
+					offsets[i] += 64;
+				}
+			}
+
+			if (k == 0) {
+				break;
+			}
+			updateMany(active, blocks, k);
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			forks[i].update(chunkTails[i] + offsets[i], chunkSizes[i] - offsets[i]);
+			active[i] = &forks[i];
+		}
+		finalMany(active, hashes + first, count);
+	}
+}
+
+// The state blob is written byte by byte, so it does not depend on the machine
+constexpr byte STATE_MAGIC[4] = { 'G', 'S', 'T', 'B' };
+constexpr byte STATE_VERSION = 1;
+
+static void storeWordsLittleEndian(byte* dst, const u64* words)
+{
+	for (int i = 0; i < 8; ++i) {
+		for (int k = 0; k < 8; ++k) {
+			dst[8 * i + k] = static_cast<byte>(words[i] >> (8 * k));
+		}
+	}
+}
+
+static void loadWordsLittleEndian(u64* words, const byte* src)
+{
+	for (int i = 0; i < 8; ++i) {
+		words[i] = 0;
+		for (int k = 0; k < 8; ++k) {
+			words[i] |= u64(src[8 * i + k]) << (8 * k);
+		}
+	}
+}
+
+u64 Hasher::processed() const
+{
+	// N counts the bits of the compressed blocks
+	return (N[0] >> 3 | N[1] << 61) + buffered;
+}
+
+void Hasher::save(byte* state) const
+{
+	byte* p = state;
+
+	memcpy(p, STATE_MAGIC, 4);
+	p += 4;
+	*p++ = STATE_VERSION;
+	*p++ = static_cast<byte>(digestSize);
+	*p++ = static_cast<byte>(buffered);
+	*p++ = 0;
+
+	const u64 count = processed();
+	for (int k = 0; k < 8; ++k) {
+		*p++ = static_cast<byte>(count >> (8 * k));
+	}
+
+	storeWordsLittleEndian(p, h);
+	storeWordsLittleEndian(p + 64, N);
+	storeWordsLittleEndian(p + 128, Sigma);
+
+	// the bytes past the partial block are left out
+	memset(p + 192, 0, 64);
+	memcpy(p + 192, buffer, buffered);
+}
+
+bool Hasher::restore(const byte* state, size_t size)
+{
+	if (size != SIZE_OF_HASHER_STATE || memcmp(state, STATE_MAGIC, 4) != 0 || state[4] != STATE_VERSION) {
+		return false;
+	}
+
+	const size_t savedDigestSize = state[5];
+	const size_t savedBuffered = state[6];
+	if ((savedDigestSize != 64 && savedDigestSize != 32) || savedBuffered >= 64 || state[7] != 0) {
+		return false;
+	}
+
+	u64 count = 0;
+	for (int k = 0; k < 8; ++k) {
+		count |= u64(state[8 + k]) << (8 * k);
+	}
+
+	u64 savedN[8];
+	loadWordsLittleEndian(savedN, state + 16 + 64);
+
+	// N is a whole number of blocks and agrees with the byte count
+	if ((savedN[0] & 511) != 0 || (savedN[0] >> 3 | savedN[1] << 61) + savedBuffered != count) {
+		memwipe(savedN, sizeof(savedN));
+		return false;
+	}
+
+	u64 savedH[8];
+	loadWordsLittleEndian(savedH, state + 16);
+
+	// before the first block h is the IV, which the prepared round keys of init() rely on
+	const bool fresh = std::all_of(savedN, savedN + 8, [](u64 w) { return w == 0; });
+	const u64 iv = savedDigestSize == 64 ? 0 : 0x0101010101010101ULL;
+	if (fresh && !std::all_of(savedH, savedH + 8, [iv](u64 w) { return w == iv; })) {
+		memwipe(savedH, sizeof(savedH));
+		memwipe(savedN, sizeof(savedN));
+		return false;
+	}
+
+	digestSize = savedDigestSize;
+	buffered = savedBuffered;
+	memcpy(h, savedH, sizeof(h));
+	memcpy(N, savedN, sizeof(N));
+	loadWordsLittleEndian(Sigma, state + 16 + 128);
+	memcpy(buffer, state + 16 + 192, 64);
+
+	if (fresh) {
+		schedule = ivSchedule(digestSize);
+	}
+	else {
+		schedule.reset();
+	}
+
+	memwipe(savedH, sizeof(savedH));
+
+	memwipe(savedN, sizeof(savedN));
+	return true;
+}
+
+// Tree nodes are hashed with a leading tag byte, so a leaf, an inner node and the root
+// never hash the same input
+enum TreeTag : byte { TREE_LEAF = 0, TREE_NODE = 1, TREE_ROOT = 2 };
+
+static void treeNode(TreeTag tag, const byte* src, size_t size, byte* digest)
+{
+	const byte t = tag;
+
+	Hasher hasher;
+	hasher.update(&t, 1);
+	hasher.update(src, size);
+	hasher.final(digest);
+}
+
+bool Hasher::treeHash(const byte* src, size_t size, byte* result, u64 leafSize, u8 fanout)
+{
+	if (leafSize < TREE_MIN_LEAF || fanout < 2) {
+		return false;
+	}
+
+	// leafSize may come from a result to check, size + leafSize may not fit
+	const u64 leaves = size / leafSize + (size % leafSize != 0);
+	if (leaves > TREE_MAX_LEAVES) {
+		return false;
+	}
+
+	// an empty message is a single empty leaf
+	size_t nodes = static_cast<size_t>(std::max<u64>(1, leaves));
+	std::vector<byte> level(nodes * 64);
+
+	parallelFor(nodes, [&](size_t i) {
+		const size_t offset = static_cast<size_t>(i * leafSize);
+		treeNode(TREE_LEAF, src + offset, static_cast<size_t>(std::min<u64>(leafSize, size - offset)), level.data() + i * 64);
+	});
+
+	while (nodes > 1) {
+		const size_t parents = (nodes + fanout - 1) / fanout;
+		std::vector<byte> upper(parents * 64);
+
+		parallelFor(parents, [&](size_t i) {
+			const size_t children = std::min<size_t>(fanout, nodes - i * fanout);
+			treeNode(TREE_NODE, level.data() + i * fanout * 64, children * 64, upper.data() + i * 64);
+		});
+
+		level.swap(upper);
+		nodes = parents;
+	}
+
+	byte params[8 + 1 + 8];
+	for (int i = 0; i < 8; ++i) {
+		params[i] = static_cast<byte>(leafSize >> (i * 8));
+		params[9 + i] = static_cast<byte>(static_cast<u64>(size) >> (i * 8));
+	}
+	params[8] = fanout;
+
+	const byte tag = TREE_ROOT;
+
+	Hasher hasher;
+	hasher.update(&tag, 1);
+	hasher.update(params, sizeof(params));
+	hasher.update(level.data(), 64);
+	hasher.final(result + 9);
+
+	memcpy(result, params, 9);
+	return true;
+}
+
+bool Hasher::treeHashMatches(const byte* src, size_t size, const byte* result)
+{
+	u64 leafSize = 0;
+	for (int i = 7; i >= 0; --i) {
+		leafSize = leafSize << 8 | result[i];
+	}
+
+	byte computed[SIZE_OF_TREE_HASH];
+	return treeHash(src, size, computed, leafSize, result[8]) && memcmp(computed, result, SIZE_OF_TREE_HASH) == 0;
+}
+
+// Stage 2 for one full block
+void Hasher::compress(const u64* m)
+{
+	if (schedule) {
+		g_NKeyed(*schedule, h, m);
+		schedule.reset();
+	}
+	else {
+		g_N(N, h, m);
+	}
+	addLength(N, 512);
+	add512(Sigma, m);
+}
+
+// Stage 3: the padded last block of `bits` message bits, then N and Sigma
+void Hasher::finish(const u64* m, u64 bits)
+{
+	static const u64 zero[8] = {};
+
+	if (schedule) {
+		g_NKeyed(*schedule, h, m);
+		schedule.reset();
+	}
+	else {
+		g_N(N, h, m);
+	}
+	addLength(N, bits);
+	add512(Sigma, m);
+
+	g_N(zero, h, N);
+	g_N(zero, h, Sigma);
+}
+
+void Hasher::updateTail(const byte* src, size_t size)
+{
+	u64 m[8];
+
+	for (const byte* block = src + size; block != src; )
+	{
+		block -= 64;
+		loadBigEndian(m, block);
+		compress(m);
+	}
+
+	memwipe(m, sizeof(m));
+}
+
+void Hasher::finalHead(const byte* src, size_t size, byte* hash)
+{
+	const size_t head = size % 64;
+	updateTail(src + head, size - head);
+
+	u8 block[64] = { 0 };
+	memcpy(block + 64 - head, src, head);
+	block[63 - head] |= 1;
+
+	u64 m[8];
+	loadBigEndian(m, block);
+	finish(m, head * 8);
+
+	// h is written big-endian, the 256-bit digest is its upper half
+	for (size_t j = 0; j < digestSize / 8; ++j) {
+		const u64 w = bswap64(h[7 - j]);
+		memcpy(hash + 8 * j, &w, 8);
+	}
+
+	memwipe(block, sizeof(block));
+	memwipe(m, sizeof(m));
+}
+
+void Hasher::update(const byte* src, size_t size)
+{
+	u64 m[8];
+
+	if (buffered > 0) {
+		const size_t n = std::min(size, 64 - buffered);
+		memcpy(buffer + buffered, src, n);
+		buffered += n;
+		src += n;
+		size -= n;
+
+		if (buffered < 64) {
+			return;
+		}
+
+		memcpy(m, buffer, 64);
+		compress(m);
+		buffered = 0;
+	}
+
+	for (; size >= 64; src += 64, size -= 64) {
+		memcpy(m, src, 64);
+		compress(m);
+	}
+
+	memcpy(buffer, src, size);
+	buffered = size;
+
+	memwipe(m, sizeof(m));
+}
+
+void Hasher::final(byte* hash)
+{
+	memset(buffer + buffered, 0, 64 - buffered);
+	buffer[buffered] = 1;
 
-	g_N(N, hash, m);
-	v512[63] = len & 0xFF;
-	v512[62] = (u8)(len >> 8);
-	AddModulo512(N, v512, N);
+	u64 m[8];
+	memcpy(m, buffer, 64);
+	finish(m, buffered * 8);
 
-	AddModulo512(Sigma, m, Sigma);
+	// h is written little-endian, the 256-bit digest is its upper half
+	memcpy(hash, reinterpret_cast<const byte*>(h) + 64 - digestSize, digestSize);
 
-	g_N(v0, hash, N);
-	g_N(v0, hash, Sigma);
+	memwipe(m, sizeof(m));
+	init();
 }
 
-} // namespace gost
\ No newline at end of file
+} // namespace gost
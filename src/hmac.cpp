@@ -0,0 +1,76 @@
+#include "hmac.h"
+#include <cstring>
+#include <vector>
+
+namespace gost
+{
+
+Hmac::Hmac(const byte* key, size_t keySize, size_t digestSize)
+	: inner(digestSize)
+	, outer(digestSize)
+	, digestSize(digestSize)
+{
+	u8 block[64] = { 0 };
+
+	// a key longer than a block is replaced with its hash
+	if (keySize > 64) {
+		Hasher hasher(digestSize);
+		hasher.update(key, keySize);
+		hasher.final(block);
+	}
+	else {
+		memcpy(block, key, keySize);
+	}
+
+	u8 pad[64];
+
+	for (int i = 0; i < 64; ++i) {
+		pad[i] = block[i] ^ 0x36;
+	}
+	inner.update(pad, 64);
+
+	for (int i = 0; i < 64; ++i) {
+		pad[i] = block[i] ^ 0x5c;
+	}
+	outer.update(pad, 64);
+
+	// every message starts from these two states
+	inner.prepare();
+	outer.prepare();
+
+	memwipe(block, sizeof(block));
+	memwipe(pad, sizeof(pad));
+}
+
+void Hmac::compute(const byte* src, size_t size, byte* mac) const
+{
+	u8 digest[64];
+
+	Hasher hasher = inner;
+	hasher.update(src, size);
+	hasher.final(digest);
+
+	hasher = outer;
+	hasher.update(digest, digestSize);
+	hasher.final(mac);
+
+	memwipe(digest, sizeof(digest));
+}
+
+void Hmac::computeMany(const byte* const* srcs, const size_t* sizes, byte* const* macs, size_t n) const
+{
+	std::vector<u8> digests(n * 64);
+	std::vector<byte*> digestPtrs(n);
+	std::vector<size_t> digestSizes(n, digestSize);
+
+	for (size_t i = 0; i < n; ++i) {
+		digestPtrs[i] = digests.data() + i * 64;
+	}
+
+	inner.finalTails(srcs, sizes, digestPtrs.data(), n);
+	outer.finalTails(digestPtrs.data(), digestSizes.data(), macs, n);
+
+	memwipe(digests.data(), digests.size());
+}
+
+} // namespace gost
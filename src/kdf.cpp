@@ -0,0 +1,233 @@
+#include "kdf.h"
+#include "parallel.h"
+#include <cstring>
+#include <memory>
+
+namespace gost
+{
+
+constexpr size_t PBKDF2_GROUP = 8; // output blocks iterated in lockstep, enough for the widest lanes
+constexpr size_t KDF_CHUNK = 256;  // derived keys per thread task
+
+struct Pbkdf2Block
+{
+	size_t password;
+	u32 index; // 1-based, as in the RFC
+};
+
+// T_i = U_1 ^ .. ^ U_c for a group of output blocks. U_1 needs the salt and is computed on its own,
+// after that every U_j is HMAC of the previous 64 bytes, the same steps for all of the group
+static void pbkdf2Group(const std::vector<std::unique_ptr<Hmac>>& hmacs, const byte* const* salts, const size_t* saltSizes,
+                        const Pbkdf2Block* blocks, size_t count, u64 iterations, u8 (*T)[64])
+{
+	u8 U[PBKDF2_GROUP][64];
+	u8 D[PBKDF2_GROUP][64];
+	Hasher hashers[PBKDF2_GROUP];
+	Hasher* hasherPtrs[PBKDF2_GROUP];
+	const byte* inputs[PBKDF2_GROUP];
+	byte* outputs[PBKDF2_GROUP];
+
+	for (size_t l = 0; l < count; ++l) {
+		const size_t p = blocks[l].password;
+		const u32 i = blocks[l].index;
+
+		std::vector<byte> first(saltSizes[p] + 4);
+		memcpy(first.data(), salts[p], saltSizes[p]);
+		first[saltSizes[p]] = static_cast<byte>(i >> 24);
+		first[saltSizes[p] + 1] = static_cast<byte>(i >> 16);
+		first[saltSizes[p] + 2] = static_cast<byte>(i >> 8);
+		first[saltSizes[p] + 3] = static_cast<byte>(i);
+
+		hmacs[p]->compute(first.data(), first.size(), U[l]);
+		memcpy(T[l], U[l], 64);
+
+		hasherPtrs[l] = &hashers[l];
+	}
+
+	for (u64 j = 1; j < iterations; ++j) {
+		for (size_t l = 0; l < count; ++l) {
+			hashers[l] = hmacs[blocks[l].password]->innerHasher();
+			inputs[l] = U[l];
+			outputs[l] = D[l];
+		}
+		Hasher::updateMany(hasherPtrs, inputs, count);
+		Hasher::finalMany(hasherPtrs, outputs, count);
+
+		for (size_t l = 0; l < count; ++l) {
+			hashers[l] = hmacs[blocks[l].password]->outerHasher();
+			inputs[l] = D[l];
+			outputs[l] = U[l];
+		}
+		Hasher::updateMany(hasherPtrs, inputs, count);
+		Hasher::finalMany(hasherPtrs, outputs, count);
+
+		for (size_t l = 0; l < count; ++l) {
+			for (int k = 0; k < 64; ++k) {
+				T[l][k] ^= U[l][k];
+			}
+		}
+	}
+
+	memwipe(U, sizeof(U));
+	memwipe(D, sizeof(D));
+}
+
+bool pbkdf2(const byte* password, size_t passwordSize, const byte* salt, size_t saltSize, u64 iterations, byte* dst, size_t dstSize)
+{
+	return pbkdf2Many(&password, &passwordSize, &salt, &saltSize, 1, iterations, &dst, dstSize);
+}
+
+bool pbkdf2Many(const byte* const* passwords, const size_t* passwordSizes, const byte* const* salts, const size_t* saltSizes,
+                size_t n, u64 iterations, byte* const* dsts, size_t dstSize)
+{
+	if (iterations == 0) {
+		return false;
+	}
+
+	std::vector<std::unique_ptr<Hmac>> hmacs;
+	for (size_t p = 0; p < n; ++p) {
+		hmacs.push_back(std::make_unique<Hmac>(passwords[p], passwordSizes[p]));
+	}
+
+	const u32 blocksPerPassword = static_cast<u32>((dstSize + 63) / 64);
+
+	std::vector<Pbkdf2Block> blocks;
+	for (size_t p = 0; p < n; ++p) {
+		for (u32 i = 1; i <= blocksPerPassword; ++i) {
+			blocks.push_back({ p, i });
+		}
+	}
+
+	// full groups keep the lanes busy, but not at the cost of idle threads
+	const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+	const size_t groupSize = std::clamp<size_t>(blocks.size() / threads, 1, PBKDF2_GROUP);
+
+	parallelFor((blocks.size() + groupSize - 1) / groupSize, [&](size_t g) {
+		const size_t first = g * groupSize;
+		const size_t count = std::min(groupSize, blocks.size() - first);
+
+		u8 T[PBKDF2_GROUP][64];
+		pbkdf2Group(hmacs, salts, saltSizes, blocks.data() + first, count, iterations, T);
+
+		for (size_t l = 0; l < count; ++l) {
+			const size_t offset = (blocks[first + l].index - 1) * size_t(64);
+			memcpy(dsts[blocks[first + l].password] + offset, T[l], std::min<size_t>(64, dstSize - offset));
+		}
+
+		memwipe(T, sizeof(T));
+	});
+
+	return true;
+}
+
+// [i] || label || 00 || seed || [L] of RFC 7836, the integers big-endian:
+// i in R bytes, L in as few bytes as it takes
+static std::vector<byte> kdfMessage(u64 i, u8 R, const byte* label, size_t labelSize, const byte* seed, size_t seedSize, u64 L)
+{
+	int lengthBytes = 1;
+	while (lengthBytes < 8 && (L >> (8 * lengthBytes)) != 0) {
+		++lengthBytes;
+	}
+
+	std::vector<byte> message(R + labelSize + 1 + seedSize + lengthBytes);
+	byte* p = message.data();
+
+	for (int k = R - 1; k >= 0; --k) {
+		*p++ = static_cast<byte>(i >> (8 * k));
+	}
+	if (labelSize != 0) {
+		memcpy(p, label, labelSize);
+		p += labelSize;
+	}
+	*p++ = 0;
+	if (seedSize != 0) {
+		memcpy(p, seed, seedSize);
+		p += seedSize;
+	}
+	for (int k = lengthBytes - 1; k >= 0; --k) {
+		*p++ = static_cast<byte>(L >> (8 * k));
+	}
+
+	return message;
+}
+
+// HMAC-256 of n messages into 32-byte outputs, in chunks over the threads
+static void kdfMacs(const Hmac& hmac, const std::vector<std::vector<byte>>& messages, byte* const* dsts)
+{
+	const size_t n = messages.size();
+
+	parallelFor((n + KDF_CHUNK - 1) / KDF_CHUNK, [&](size_t c) {
+		const size_t first = c * KDF_CHUNK;
+		const size_t count = std::min(KDF_CHUNK, n - first);
+
+		std::vector<const byte*> srcs(count);
+		std::vector<size_t> sizes(count);
+		for (size_t i = 0; i < count; ++i) {
+			srcs[i] = messages[first + i].data();
+			sizes[i] = messages[first + i].size();
+		}
+
+		hmac.computeMany(srcs.data(), sizes.data(), dsts + first, count);
+	});
+}
+
+void kdf256(const byte* key, size_t keySize, const byte* label, size_t labelSize, const byte* seed, size_t seedSize,
+            SecuredByteArray<32>& dst)
+{
+	kdf256Many(key, keySize, &label, &labelSize, &seed, &seedSize, 1, &dst);
+}
+
+void kdf256Many(const byte* key, size_t keySize, const byte* const* labels, const size_t* labelSizes,
+                const byte* const* seeds, const size_t* seedSizes, size_t n, SecuredByteArray<32>* dsts)
+{
+	const Hmac hmac(key, keySize, 32);
+
+	std::vector<std::vector<byte>> messages;
+	std::vector<byte*> dstPtrs;
+	for (size_t i = 0; i < n; ++i) {
+		messages.push_back(kdfMessage(1, 1, labels[i], labelSizes[i], seeds[i], seedSizes[i], 256));
+		dstPtrs.push_back(reinterpret_cast<byte*>(dsts[i].data()));
+	}
+
+	kdfMacs(hmac, messages, dstPtrs.data());
+}
+
+bool kdfTree256(const byte* key, size_t keySize, const byte* label, size_t labelSize, const byte* seed, size_t seedSize,
+                u8 R, SecuredByteVector& dst)
+{
+	if (dst.empty() || R < 1 || R > 4) {
+		return false;
+	}
+
+	const u64 blocks = (dst.size() + 31) / 32;
+	if (blocks > (u64(1) << (8 * R)) - 1) {
+		return false;
+	}
+
+	const Hmac hmac(key, keySize, 32);
+	const u64 L = u64(8) * dst.size();
+
+	std::vector<std::vector<byte>> messages;
+	for (u64 i = 1; i <= blocks; ++i) {
+		messages.push_back(kdfMessage(i, R, label, labelSize, seed, seedSize, L));
+	}
+
+	// whole blocks go straight to dst, a short last one through a buffer
+	u8 last[32];
+	std::vector<byte*> dstPtrs;
+	for (u64 i = 0; i < blocks; ++i) {
+		const bool whole = (i + 1) * 32 <= dst.size();
+		dstPtrs.push_back(whole ? reinterpret_cast<byte*>(dst.data()) + i * 32 : last);
+	}
+
+	kdfMacs(hmac, messages, dstPtrs.data());
+
+	if (dst.size() % 32 != 0) {
+		memcpy(dst.data() + (blocks - 1) * 32, last, dst.size() % 32);
+		memwipe(last, sizeof(last));
+	}
+
+	return true;
+}
+
+} // namespace gost
@@ -0,0 +1,325 @@
+#include "kuznyechik.h"
+#include "parallel.h"
+#include "bytes.h"
+#include "cpu.h"
+#include <array>
+#include <cstring>
+
+#if defined(GOST_X86) && (defined(__SSE2__) || defined(_M_X64))
+#define GOST_KUZNYECHIK_SSE2
+#endif
+
+namespace gost
+{
+
+static constexpr u8 Pi[256] =
+{
+	0xfc, 0xee, 0xdd, 0x11, 0xcf, 0x6e, 0x31, 0x16, 0xfb, 0xc4, 0xfa, 0xda, 0x23, 0xc5, 0x04, 0x4d,
+	0xe9, 0x77, 0xf0, 0xdb, 0x93, 0x2e, 0x99, 0xba, 0x17, 0x36, 0xf1, 0xbb, 0x14, 0xcd, 0x5f, 0xc1,
+	0xf9, 0x18, 0x65, 0x5a, 0xe2, 0x5c, 0xef, 0x21, 0x81, 0x1c, 0x3c, 0x42, 0x8b, 0x01, 0x8e, 0x4f,
+	0x05, 0x84, 0x02, 0xae, 0xe3, 0x6a, 0x8f, 0xa0, 0x06, 0x0b, 0xed, 0x98, 0x7f, 0xd4, 0xd3, 0x1f,
+	0xeb, 0x34, 0x2c, 0x51, 0xea, 0xc8, 0x48, 0xab, 0xf2, 0x2a, 0x68, 0xa2, 0xfd, 0x3a, 0xce, 0xcc,
+	0xb5, 0x70, 0x0e, 0x56, 0x08, 0x0c, 0x76, 0x12, 0xbf, 0x72, 0x13, 0x47, 0x9c, 0xb7, 0x5d, 0x87,
+	0x15, 0xa1, 0x96, 0x29, 0x10, 0x7b, 0x9a, 0xc7, 0xf3, 0x91, 0x78, 0x6f, 0x9d, 0x9e, 0xb2, 0xb1,
+	0x32, 0x75, 0x19, 0x3d, 0xff, 0x35, 0x8a, 0x7e, 0x6d, 0x54, 0xc6, 0x80, 0xc3, 0xbd, 0x0d, 0x57,
+	0xdf, 0xf5, 0x24, 0xa9, 0x3e, 0xa8, 0x43, 0xc9, 0xd7, 0x79, 0xd6, 0xf6, 0x7c, 0x22, 0xb9, 0x03,
+	0xe0, 0x0f, 0xec, 0xde, 0x7a, 0x94, 0xb0, 0xbc, 0xdc, 0xe8, 0x28, 0x50, 0x4e, 0x33, 0x0a, 0x4a,
+	0xa7, 0x97, 0x60, 0x73, 0x1e, 0x00, 0x62, 0x44, 0x1a, 0xb8, 0x38, 0x82, 0x64, 0x9f, 0x26, 0x41,
+	0xad, 0x45, 0x46, 0x92, 0x27, 0x5e, 0x55, 0x2f, 0x8c, 0xa3, 0xa5, 0x7d, 0x69, 0xd5, 0x95, 0x3b,
+	0x07, 0x58, 0xb3, 0x40, 0x86, 0xac, 0x1d, 0xf7, 0x30, 0x37, 0x6b, 0xe4, 0x88, 0xd9, 0xe7, 0x89,
+	0xe1, 0x1b, 0x83, 0x49, 0x4c, 0x3f, 0xf8, 0xfe, 0x8d, 0x53, 0xaa, 0x90, 0xca, 0xd8, 0x85, 0x61,
+	0x20, 0x71, 0x67, 0xa4, 0x2d, 0x2b, 0x09, 0x5b, 0xcb, 0x9b, 0x25, 0xd0, 0xbe, 0xe5, 0x6c, 0x52,
+	0x59, 0xa6, 0x74, 0xd2, 0xe6, 0xf4, 0xb4, 0xc0, 0xd1, 0x66, 0xaf, 0xc2, 0x39, 0x4b, 0x63, 0xb6,
+};
+
+// coefficients of l(a15, .., a0), a15 first as it is the first byte of a block
+static constexpr u8 lCoefs[16] = { 148, 32, 133, 16, 194, 192, 1, 251, 1, 192, 194, 16, 133, 32, 148, 1 };
+
+using Block = std::array<u8, 16>;
+
+// multiplication in GF(2^8) modulo x^8 + x^7 + x^6 + x + 1
+static constexpr u8 gfMul(u8 a, u8 b)
+{
+	u8 r = 0;
+	while (b) {
+		if (b & 1) {
+			r ^= a;
+		}
+		a = static_cast<u8>((a << 1) ^ (a & 0x80 ? 0xC3 : 0));
+		b >>= 1;
+	}
+	return r;
+}
+
+// L = R^16
+static constexpr Block L(Block a)
+{
+	for (int round = 0; round < 16; ++round) {
+		u8 l = 0;
+		for (int i = 0; i < 16; ++i) {
+			l ^= gfMul(a[i], lCoefs[i]);
+		}
+		for (int i = 15; i > 0; --i) {
+			a[i] = a[i - 1];
+		}
+		a[0] = l;
+	}
+	return a;
+}
+
+static constexpr u64 load64(const Block& a, int from)
+{
+	u64 r = 0;
+	for (int i = 7; i >= 0; --i) {
+		r = r << 8 | a[from + i];
+	}
+	return r;
+}
+
+// LS[i][b] = L(S(x)) of a block x having only the byte i set to b. L is linear,
+// so L(S(x)) of any block is the XOR of sixteen entries, one per byte
+struct LsTables
+{
+	alignas(16) u64 t[16][256][2];
+};
+
+static constexpr LsTables makeLsTables()
+{
+	Block basis[16] = {};
+	for (int i = 0; i < 16; ++i) {
+		Block e = {};
+		e[i] = 1;
+		basis[i] = L(e);
+	}
+
+	LsTables ls = {};
+	for (int i = 0; i < 16; ++i) {
+		for (int b = 0; b < 256; ++b) {
+			Block e = {};
+			for (int k = 0; k < 16; ++k) {
+				e[k] = gfMul(basis[i][k], Pi[b]);
+			}
+			ls.t[i][b][0] = load64(e, 0);
+			ls.t[i][b][1] = load64(e, 8);
+		}
+	}
+	return ls;
+}
+
+struct KeyConstants
+{
+	u64 c[32][2];
+};
+
+// C_i = L(Vec128(i)) of the key schedule
+static constexpr KeyConstants makeKeyConstants()
+{
+	KeyConstants kc = {};
+	for (int i = 0; i < 32; ++i) {
+		Block v = {};
+		v[15] = static_cast<u8>(i + 1);
+		v = L(v);
+		kc.c[i][0] = load64(v, 0);
+		kc.c[i][1] = load64(v, 8);
+	}
+	return kc;
+}
+
+static constexpr LsTables LS = makeLsTables();
+static constexpr KeyConstants C = makeKeyConstants();
+
+static inline void ls(u64* x)
+{
+	u64 lo = 0;
+	u64 hi = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		const u8 b = static_cast<u8>(x[i / 8] >> (i % 8 * 8));
+		lo ^= LS.t[i][b][0];
+		hi ^= LS.t[i][b][1];
+	}
+
+	x[0] = lo;
+	x[1] = hi;
+}
+
+void Kuznyechik::expandKey(const byte* key, u64 (*K)[2])
+{
+	memcpy(K[0], key, 16);
+	memcpy(K[1], key + 16, 16);
+
+	// four rounds of eight Feistel steps, each round gives the next pair of keys
+	for (int i = 0; i < 4; ++i) {
+		u64 a1[2] = { K[2 * i][0], K[2 * i][1] };
+		u64 a0[2] = { K[2 * i + 1][0], K[2 * i + 1][1] };
+
+		for (int j = 0; j < 8; ++j) {
+			u64 t[2] = { a1[0] ^ C.c[8 * i + j][0], a1[1] ^ C.c[8 * i + j][1] };
+			ls(t);
+			t[0] ^= a0[0];
+			t[1] ^= a0[1];
+
+			a0[0] = a1[0];
+			a0[1] = a1[1];
+			a1[0] = t[0];
+			a1[1] = t[1];
+		}
+
+		K[2 * i + 2][0] = a1[0];
+		K[2 * i + 2][1] = a1[1];
+		K[2 * i + 3][0] = a0[0];
+		K[2 * i + 3][1] = a0[1];
+
+		memwipe(a1, 16);
+		memwipe(a0, 16);
+	}
+}
+
+#ifdef GOST_KUZNYECHIK_SSE2
+// _mm_extract_epi16() wants a constant, so the sixteen lookups are spelled out
+#define LS_STEP(x, r, i) { \
+	const int w = _mm_extract_epi16(x, i); \
+	r = _mm_xor_si128(r, _mm_load_si128(reinterpret_cast<const __m128i*>(LS.t[2 * i][w & 0xFF]))); \
+	r = _mm_xor_si128(r, _mm_load_si128(reinterpret_cast<const __m128i*>(LS.t[2 * i + 1][w >> 8]))); \
+}
+
+static inline __m128i lsSse2(__m128i x)
+{
+	__m128i r = _mm_setzero_si128();
+	LS_STEP(x, r, 0) LS_STEP(x, r, 1) LS_STEP(x, r, 2) LS_STEP(x, r, 3)
+	LS_STEP(x, r, 4) LS_STEP(x, r, 5) LS_STEP(x, r, 6) LS_STEP(x, r, 7)
+	return r;
+}
+
+#undef LS_STEP
+#endif
+
+// Encrypts blocks in place. Four of them go through each round together, so the lookups
+// of one block overlap the ones of the others
+void Kuznyechik::cryptBlocks(u64 (*blocks)[2], size_t n, const u64 (*K)[2])
+{
+	size_t j = 0;
+
+#ifdef GOST_KUZNYECHIK_SSE2
+	__m128i k[10];
+	for (int r = 0; r < 10; ++r) {
+		k[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(K[r]));
+	}
+
+	for (; j + 4 <= n; j += 4) {
+		__m128i* p = reinterpret_cast<__m128i*>(blocks + j);
+		__m128i x0 = _mm_loadu_si128(p);
+		__m128i x1 = _mm_loadu_si128(p + 1);
+		__m128i x2 = _mm_loadu_si128(p + 2);
+		__m128i x3 = _mm_loadu_si128(p + 3);
+
+		for (int r = 0; r < 9; ++r) {
+			x0 = lsSse2(_mm_xor_si128(x0, k[r]));
+			x1 = lsSse2(_mm_xor_si128(x1, k[r]));
+			x2 = lsSse2(_mm_xor_si128(x2, k[r]));
+			x3 = lsSse2(_mm_xor_si128(x3, k[r]));
+		}
+
+		_mm_storeu_si128(p, _mm_xor_si128(x0, k[9]));
+		_mm_storeu_si128(p + 1, _mm_xor_si128(x1, k[9]));
+		_mm_storeu_si128(p + 2, _mm_xor_si128(x2, k[9]));
+		_mm_storeu_si128(p + 3, _mm_xor_si128(x3, k[9]));
+	}
+
+	for (int r = 0; r < 10; ++r) {
+		k[r] = _mm_setzero_si128();
+	}
+#else
+	for (; j + 4 <= n; j += 4) {
+		for (int r = 0; r < 9; ++r) {
+			for (size_t b = j; b < j + 4; ++b) {
+				blocks[b][0] ^= K[r][0];
+				blocks[b][1] ^= K[r][1];
+				ls(blocks[b]);
+			}
+		}
+
+		for (size_t b = j; b < j + 4; ++b) {
+			blocks[b][0] ^= K[9][0];
+			blocks[b][1] ^= K[9][1];
+		}
+	}
+#endif
+
+	for (; j < n; ++j) {
+		for (int r = 0; r < 9; ++r) {
+			blocks[j][0] ^= K[r][0];
+			blocks[j][1] ^= K[r][1];
+			ls(blocks[j]);
+		}
+
+		blocks[j][0] ^= K[9][0];
+		blocks[j][1] ^= K[9][1];
+	}
+}
+
+void Kuznyechik::cryptBlock(const byte* src, byte* dst, const byte* key)
+{
+	u64 K[10][2];
+	expandKey(key, K);
+
+	u64 block[1][2];
+	memcpy(block, src, 16);
+	cryptBlocks(block, 1, K);
+	memcpy(dst, block, 16);
+
+	memwipe(K, sizeof(K));
+	memwipe(block, sizeof(block));
+}
+
+void Kuznyechik::cryptCtr(const byte* src, byte* dst, size_t size, const byte* key, u64 iv)
+{
+	u64 K[10][2];
+	expandKey(key, K);
+
+	// the counter block is iv || block number, both big-endian. A message of size_t bytes
+	// never carries out of the lower half
+	const u64 upper = bswap64(iv);
+
+	parallelFor((size + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK, [&](size_t i) {
+		size_t offset = i * PARALLEL_CHUNK;
+		const size_t end = std::min(size, offset + PARALLEL_CHUNK);
+
+		u64 gamma[GAMMA_BATCH][2];
+		u64 counter = offset / 16;
+
+		while (offset < end) {
+			const size_t n = std::min(GAMMA_BATCH, (end - offset + 15) / 16);
+
+			for (size_t j = 0; j < n; ++j) {
+				gamma[j][0] = upper;
+				gamma[j][1] = bswap64(counter++);
+			}
+
+			cryptBlocks(gamma, n, K);
+
+			const size_t bytes = std::min(n * 16, end - offset);
+			const byte* g = reinterpret_cast<const byte*>(gamma);
+			size_t j = 0;
+
+			for (; j + 8 <= bytes; j += 8) {
+				u64 word;
+				memcpy(&word, src + offset + j, 8);
+				word ^= gamma[j / 16][j / 8 % 2];
+				memcpy(dst + offset + j, &word, 8);
+			}
+
+			for (; j < bytes; ++j) {
+				dst[offset + j] = src[offset + j] ^ g[j];
+			}
+
+			offset += bytes;
+		}
+
+		memwipe(gamma, sizeof(gamma));
+	});
+
+	memwipe(K, sizeof(K));
+}
+
+} // namespace gost
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace gost
+{
+
+// Bulk modes split their input into chunks of this size for parallelFor()
+constexpr size_t PARALLEL_CHUNK = 64 * 1024;
+constexpr size_t GAMMA_BATCH = 32; // blocks of gamma produced at once, for cryptBlocks() to interleave
+
+// Calls fn(i) for every i in [0, count) on up to hardware_concurrency() threads, the calling one included.
+// Indices are handed out one by one, so the result must not depend on which thread runs which of them.
+template<typename F>
+void parallelFor(size_t count, F&& fn)
+{
+	const size_t threads = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+
+	std::atomic<size_t> next = 0;
+	const auto worker = [&] {
+		for (size_t i = next++; i < count; i = next++) {
+			fn(i);
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (size_t t = 1; t < threads; ++t) {
+		pool.emplace_back(worker);
+	}
+
+	worker();
+
+	for (std::thread& thread : pool) {
+		thread.join();
+	}
+}
+
+} // namespace gost
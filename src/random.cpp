@@ -0,0 +1,141 @@
+#include "secure_types.h"
+#include "kuznyechik.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <random>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#include <cerrno>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace gost
+{
+
+// Every thread has its own generator: Kuznyechik CTR under a key that is replaced by the first
+// output block of every refill, so the state never tells what was generated before it. Keys come
+// from the OS and get fresh entropy mixed in every RESEED_INTERVAL bytes and after fork()
+constexpr size_t RANDOM_POOL = 4096;
+constexpr size_t RESEED_INTERVAL = 1 << 20;
+
+// bumped in a child process, whose generators are copies of the parent's ones
+static std::atomic<u64> forkGeneration = 0;
+
+#if defined(__unix__) || defined(__APPLE__)
+static const int forkHandler = pthread_atfork(nullptr, nullptr, [] { ++forkGeneration; });
+#endif
+
+static void osRandom(byte* dst, size_t size)
+{
+#if defined(__linux__)
+	while (size) {
+		const ssize_t n = getrandom(dst, size, 0);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		dst += n;
+		size -= n;
+	}
+
+	if (size == 0) {
+		return;
+	}
+#endif
+
+	// no getrandom(), or it failed
+	std::random_device device;
+	while (size) {
+		const u32 word = device();
+		const size_t n = std::min(size, sizeof(word));
+		memcpy(dst, &word, n);
+		dst += n;
+		size -= n;
+	}
+}
+
+class RandomSource
+{
+public:
+	~RandomSource()
+	{
+		memwipe(key, sizeof(key));
+		memwipe(pool, sizeof(pool));
+	}
+
+	void fill(byte* dst, size_t size)
+	{
+		// what is left of the pool in a child process is the parent's as well
+		if (generation != forkGeneration.load(std::memory_order_relaxed)) {
+			memwipe(pool, sizeof(pool));
+			available = 0;
+		}
+
+		while (size) {
+			if (available == 0) {
+				refill();
+			}
+
+			// handed out bytes do not stay in the pool
+			byte* src = pool + RANDOM_POOL - available;
+			const size_t n = std::min(size, available);
+			memcpy(dst, src, n);
+			memwipe(src, n);
+
+			available -= n;
+			dst += n;
+			size -= n;
+		}
+	}
+
+private:
+	byte key[32] = {};
+	byte pool[RANDOM_POOL];
+	size_t available = 0;
+	size_t sinceReseed = RESEED_INTERVAL;
+	u64 generation = 0;
+	u64 nonce = 0;
+
+	void refill()
+	{
+		if (sinceReseed >= RESEED_INTERVAL || generation != forkGeneration.load(std::memory_order_relaxed)) {
+			reseed();
+		}
+
+		byte out[sizeof(key) + RANDOM_POOL] = {};
+		Kuznyechik::cryptCtr(out, out, sizeof(out), key, nonce++);
+
+		memcpy(key, out, sizeof(key));
+		memcpy(pool, out + sizeof(key), RANDOM_POOL);
+		available = RANDOM_POOL;
+		sinceReseed += sizeof(out);
+
+		memwipe(out, sizeof(out));
+	}
+
+	void reseed()
+	{
+		byte entropy[sizeof(key)];
+		osRandom(entropy, sizeof(entropy));
+		memxor(key, entropy, sizeof(key));
+		memwipe(entropy, sizeof(entropy));
+
+		generation = forkGeneration.load(std::memory_order_relaxed);
+		sinceReseed = 0;
+	}
+};
+
+void memrandomset(void* ptr, size_t len)
+{
+	thread_local RandomSource source;
+	source.fill(static_cast<byte*>(ptr), len);
+}
+
+} // namespace gost
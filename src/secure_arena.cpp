@@ -0,0 +1,297 @@
+#include "secure_types.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace gost
+{
+
+// Locked memory is handed out in power of two chunks of 32 bytes to 64 KB, carved from 1 MB regions
+// that are locked once. A thread keeps freed chunks of every size in a list of its own and trades
+// them with the shared lists a batch at a time, so most calls take no lock and no syscall.
+// Larger blocks get a mapping of their own. Regions are never given back to the system
+constexpr size_t MIN_CHUNK = LOCKED_ALIGNMENT; // chunks are multiples of it, so they all start aligned
+constexpr size_t CHUNK_CLASSES = 12; // up to 64 KB
+constexpr size_t MAX_CHUNK = MIN_CHUNK << (CHUNK_CLASSES - 1);
+constexpr size_t REGION_SIZE = 1 << 20;
+constexpr size_t BATCH_BYTES = 16 * 1024; // chunks moved between a thread and the shared lists at once
+
+static std::atomic<size_t> lockFailureCount = 0;
+
+// Pages that stay in RAM and out of core dumps. Locking is best effort: when RLIMIT_MEMLOCK
+// is used up the memory is still served, only unlocked, and lockFailures() counts it
+static void* mapLocked(size_t size)
+{
+#if defined(_WIN32)
+	void* p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (p && !VirtualLock(p, size)) {
+		++lockFailureCount;
+	}
+	return p;
+#elif defined(__unix__) || defined(__APPLE__)
+	void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED) {
+		return nullptr;
+	}
+	if (mlock(p, size) != 0) {
+		++lockFailureCount;
+	}
+#ifdef MADV_DONTDUMP
+	madvise(p, size, MADV_DONTDUMP);
+#endif
+	return p;
+#else
+	void* p = ::operator new(size, std::nothrow);
+	if (p) {
+		++lockFailureCount;
+	}
+	return p;
+#endif
+}
+
+static void unmapLocked(void* p, size_t size)
+{
+#if defined(_WIN32)
+	VirtualUnlock(p, size);
+	VirtualFree(p, 0, MEM_RELEASE);
+#elif defined(__unix__) || defined(__APPLE__)
+	munlock(p, size);
+	munmap(p, size);
+#else
+	(void)size;
+	::operator delete(p);
+#endif
+}
+
+static size_t pageSize()
+{
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwPageSize;
+#elif defined(__unix__) || defined(__APPLE__)
+	return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+	return 4096;
+#endif
+}
+
+static size_t chunkClass(size_t size)
+{
+	size_t c = 0;
+	while ((MIN_CHUNK << c) < size) {
+		++c;
+	}
+	return c;
+}
+
+// a free chunk keeps the next one of its list in its first bytes
+struct FreeChunk
+{
+	FreeChunk* next;
+};
+
+class SharedArena
+{
+public:
+	// takes up to `count` chunks of class c, returns the list and sets count to how many there are
+	FreeChunk* take(size_t c, size_t& count)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		FreeChunk* head = nullptr;
+		size_t taken = 0;
+
+		for (; taken < count && lists[c]; ++taken) {
+			FreeChunk* chunk = lists[c];
+			lists[c] = chunk->next;
+			chunk->next = head;
+			head = chunk;
+		}
+
+		const size_t size = MIN_CHUNK << c;
+		for (; taken < count; ++taken) {
+			if (regionLeft < size) {
+				spillRegion();
+				region = static_cast<byte*>(mapLocked(REGION_SIZE));
+				regionLeft = region ? REGION_SIZE : 0;
+				if (!region) {
+					break;
+				}
+			}
+
+			FreeChunk* chunk = reinterpret_cast<FreeChunk*>(region + REGION_SIZE - regionLeft);
+			regionLeft -= size;
+			chunk->next = head;
+			head = chunk;
+		}
+
+		count = taken;
+		return head;
+	}
+
+	void give(size_t c, FreeChunk* head)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		while (head) {
+			FreeChunk* next = head->next;
+			head->next = lists[c];
+			lists[c] = head;
+			head = next;
+		}
+	}
+
+private:
+	std::mutex mutex;
+	FreeChunk* lists[CHUNK_CLASSES] = {};
+	byte* region = nullptr;
+	size_t regionLeft = 0;
+
+	// The end of a region too short for the chunk asked for goes to the lists of smaller chunks,
+	// it is locked memory all the same. regionLeft is a multiple of MIN_CHUNK
+	void spillRegion()
+	{
+		while (regionLeft >= MIN_CHUNK) {
+			size_t c = CHUNK_CLASSES - 1;
+			while ((MIN_CHUNK << c) > regionLeft) {
+				--c;
+			}
+
+			FreeChunk* chunk = reinterpret_cast<FreeChunk*>(region + REGION_SIZE - regionLeft);
+			chunk->next = lists[c];
+			lists[c] = chunk;
+			regionLeft -= MIN_CHUNK << c;
+		}
+	}
+};
+
+// never destroyed, threads may still give chunks back while static objects go away
+static SharedArena& sharedArena()
+{
+	static SharedArena* arena = new SharedArena;
+	return *arena;
+}
+
+static size_t batchOf(size_t c)
+{
+	return std::max<size_t>(1, BATCH_BYTES / (MIN_CHUNK << c));
+}
+
+// set once the cache of the thread is destroyed, the objects destroyed after it go to the shared lists
+static thread_local bool threadCacheGone = false;
+
+class ThreadCache
+{
+public:
+	~ThreadCache()
+	{
+		for (size_t c = 0; c < CHUNK_CLASSES; ++c) {
+			sharedArena().give(c, lists[c]);
+		}
+		threadCacheGone = true;
+	}
+
+	void* allocate(size_t c)
+	{
+		if (!lists[c]) {
+			size_t count = batchOf(c);
+			lists[c] = sharedArena().take(c, count);
+			counts[c] = count;
+
+			if (!lists[c]) {
+				return nullptr;
+			}
+		}
+
+		FreeChunk* chunk = lists[c];
+		lists[c] = chunk->next;
+		--counts[c];
+		return chunk;
+	}
+
+	void deallocate(size_t c, void* p)
+	{
+		FreeChunk* chunk = static_cast<FreeChunk*>(p);
+		chunk->next = lists[c];
+		lists[c] = chunk;
+
+		// a thread that frees more than it allocates passes the surplus on
+		if (++counts[c] > 2 * batchOf(c)) {
+			FreeChunk* surplus = lists[c];
+			FreeChunk* last = surplus;
+			for (size_t i = 1; i < batchOf(c); ++i) {
+				last = last->next;
+			}
+
+			lists[c] = last->next;
+			last->next = nullptr;
+			counts[c] -= batchOf(c);
+			sharedArena().give(c, surplus);
+		}
+	}
+
+private:
+	FreeChunk* lists[CHUNK_CLASSES] = {};
+	size_t counts[CHUNK_CLASSES] = {};
+};
+
+static thread_local ThreadCache threadCache;
+
+void* lockedAlloc(size_t size)
+{
+	if (size > MAX_CHUNK) {
+		const size_t page = pageSize();
+		return mapLocked((size + page - 1) / page * page);
+	}
+
+	const size_t c = chunkClass(std::max<size_t>(size, 1));
+	if (threadCacheGone) {
+		size_t count = 1;
+		return sharedArena().take(c, count);
+	}
+
+	return threadCache.allocate(c);
+}
+
+void lockedFree(void* ptr, size_t size)
+{
+	if (!ptr) {
+		return;
+	}
+
+	memwipe(ptr, size);
+
+	if (size > MAX_CHUNK) {
+		const size_t page = pageSize();
+		unmapLocked(ptr, (size + page - 1) / page * page);
+		return;
+	}
+
+	const size_t c = chunkClass(std::max<size_t>(size, 1));
+	if (threadCacheGone) {
+		FreeChunk* chunk = static_cast<FreeChunk*>(ptr);
+		chunk->next = nullptr;
+		sharedArena().give(c, chunk);
+		return;
+	}
+
+	threadCache.deallocate(c, ptr);
+}
+
+size_t lockFailures()
+{
+	return lockFailureCount;
+}
+
+} // namespace gost
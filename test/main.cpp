@@ -1,9 +1,27 @@
 #include "crypt.h"
+#include "kuznyechik.h"
+#include "hmac.h"
+#include "kdf.h"
 #include "cryptTests.h"
 
 #include <iostream>
 #include <iomanip>
 #include <ctime>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+#if defined(__unix__)
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif
 
 using namespace gost;
 
@@ -19,6 +37,15 @@ static void printBytes(const byte *bytes, int size) {
 	std::cout << std::endl << std::endl;
 }
 
+static std::vector<byte> fromHex(const char* hex)
+{
+	std::vector<byte> bytes;
+	for (; hex[0] && hex[1]; hex += 2) {
+		bytes.push_back(static_cast<byte>(std::stoi(std::string(hex, 2), nullptr, 16)));
+	}
+	return bytes;
+}
+
 static void printResult(bool pass)
 {
 	std::cout << PAD << (pass ? "PASS" : "FAIL") << std::endl;
@@ -72,7 +99,1217 @@ static bool runCryptTests()
 
 	std::cout << PAD << ms << " ms" << std::endl;
 	std::cout << PAD << speed << " Mb/s" << std::endl;
-	return true;
+	return pass;
+}
+
+static bool runHashTests()
+{
+	// GOST R 34.11-2012 examples, written as big-endian numbers
+	const char* M1 = "3231303938373635343332313039383736353433323130393837363534333231"
+	                 "30393837363534333231303938373635343332313039383736353433323130";
+	const char* M2 = "fbe2e5f0eee3c820fbeafaebef20fffbf0e1e0f0f520e0ed20e8ece0ebe5f0f2f120fff0eeec20f120faf2"
+	                 "fee5e2202ce8f6f3ede220e8e6eee1e8f0f2d1202ce8f0f2e5e220e5d1";
+
+	struct HashTest
+	{
+		const char* message;
+		const char* digest512;
+		const char* digest256;
+	};
+
+	const HashTest tests[] = {
+		{ M1, "486f64c1917879417fef082b3381a4e211c324f074654c38823a7b76f830ad00"
+		      "fa1fbae42b1285c0352f227524bc9ab16254288dd6863dccd5b9f54a1ad0541b",
+		      "00557be5e584fd52a449b16b0251d05d27f94ab76cbaa6da890b59d8ef1e159d" },
+		{ M2, "28fbc9bada033b1460642bdcddb90c3fb3e56c497ccd0f62b8a2ad4935e85f03"
+		      "7613966de4ee00531ae60f3b5a47f8dae06915d5f2f194996fcabf2622e6881e",
+		      "508f7e553c06501d749a66fc28c6cac0b005746d97537fa85d9e40904efed29d" },
+	};
+
+	bool pass = true;
+
+	for (const HashTest& test : tests) {
+		for (const char* digest : { test.digest512, test.digest256 }) {
+			std::vector<byte> src = fromHex(test.message);
+			std::vector<byte> expected = fromHex(digest);
+			const size_t digestSize = expected.size();
+			byte hash[64];
+
+			if (digestSize == 64) {
+				Hasher::hash(src.data(), hash, src.size());
+			}
+			else {
+				Hasher::hash256(src.data(), hash, src.size());
+			}
+			pass &= memcmp(hash, expected.data(), digestSize) == 0;
+
+			// the stream reads byte strings, the examples are numbers
+			std::reverse(src.begin(), src.end());
+			std::reverse(expected.begin(), expected.end());
+
+			Hasher hasher(digestSize);
+			for (size_t i = 0; i < src.size(); i += 5) {
+				hasher.update(src.data() + i, std::min<size_t>(5, src.size() - i));
+			}
+			hasher.final(hash);
+			pass &= memcmp(hash, expected.data(), digestSize) == 0;
+		}
+	}
+
+	// any split of a message gives the digest of the whole one
+	Hasher hasher;
+	for (size_t size : { 0, 1, 63, 64, 65, 127, 128, 1000 }) {
+		std::vector<byte> data(size);
+		for (size_t i = 0; i < size; ++i) {
+			data[i] = static_cast<byte>(i * 11 + 1);
+		}
+
+		std::vector<byte> reversed(data.rbegin(), data.rend());
+		byte expected[64];
+		Hasher::hash(reversed.data(), expected, size);
+		std::reverse(expected, expected + 64);
+
+		for (size_t split : { size_t(0), size / 3, size }) {
+			byte hash[64];
+			hasher.update(data.data(), split);
+			hasher.update(data.data() + split, size - split);
+			hasher.final(hash);
+			pass &= memcmp(hash, expected, 64) == 0;
+		}
+	}
+
+	return pass;
+}
+
+static bool runSharedPrefixTests()
+{
+	bool pass = true;
+
+	// prefixes ending inside a block and on its boundary, tails of every length up to a few blocks
+	for (size_t prefixSize : { size_t(0), size_t(128), size_t(200) }) {
+		for (size_t digestSize : { size_t(64), size_t(32) }) {
+			std::vector<byte> prefix(prefixSize);
+			for (size_t j = 0; j < prefix.size(); ++j) {
+				prefix[j] = static_cast<byte>(j * 7);
+			}
+
+			std::vector<std::vector<byte>> tails(40);
+			std::vector<const byte*> tailPtrs;
+			std::vector<size_t> sizes;
+			for (size_t i = 0; i < tails.size(); ++i) {
+				tails[i].resize(i * 29 % 250);
+				for (size_t j = 0; j < tails[i].size(); ++j) {
+					tails[i][j] = static_cast<byte>(i + j * 11);
+				}
+				tailPtrs.push_back(tails[i].data());
+				sizes.push_back(tails[i].size());
+			}
+
+			Hasher snapshot(digestSize);
+			snapshot.update(prefix.data(), prefix.size());
+
+			std::vector<std::vector<byte>> batch(tails.size(), std::vector<byte>(digestSize));
+			std::vector<byte*> batchPtrs;
+			for (auto& digest : batch) {
+				batchPtrs.push_back(digest.data());
+			}
+			snapshot.finalTails(tailPtrs.data(), sizes.data(), batchPtrs.data(), tails.size());
+
+			// with the round keys of the snapshot expanded in advance
+			std::vector<std::vector<byte>> prepared(tails.size(), std::vector<byte>(digestSize));
+			std::vector<byte*> preparedPtrs;
+			for (auto& digest : prepared) {
+				preparedPtrs.push_back(digest.data());
+			}
+			Hasher preparedSnapshot = snapshot;
+			preparedSnapshot.prepare();
+			preparedSnapshot.finalTails(tailPtrs.data(), sizes.data(), preparedPtrs.data(), tails.size());
+			pass &= prepared == batch;
+
+			for (size_t i = 0; i < tails.size(); ++i) {
+				std::vector<byte> whole = prefix;
+				whole.insert(whole.end(), tails[i].begin(), tails[i].end());
+
+				byte expected[64];
+				Hasher hasher(digestSize);
+				hasher.update(whole.data(), whole.size());
+				hasher.final(expected);
+
+				byte forked[64];
+				Hasher fork = snapshot;
+				fork.update(tails[i].data(), tails[i].size());
+				fork.final(forked);
+
+				pass &= memcmp(forked, expected, digestSize) == 0;
+				pass &= memcmp(batch[i].data(), expected, digestSize) == 0;
+			}
+
+			// the snapshot still holds the prefix alone
+			byte expected[64];
+			byte digest[64];
+			Hasher hasher(digestSize);
+			hasher.update(prefix.data(), prefix.size());
+			hasher.final(expected);
+			snapshot.final(digest);
+			pass &= memcmp(digest, expected, digestSize) == 0;
+		}
+	}
+
+	return pass;
+}
+
+static bool runCheckpointTests()
+{
+	bool pass = true;
+
+	std::vector<byte> message(1000);
+	for (size_t i = 0; i < message.size(); ++i) {
+		message[i] = static_cast<byte>(i * 13);
+	}
+
+	for (size_t digestSize : { size_t(64), size_t(32) }) {
+		byte expected[64];
+		Hasher whole(digestSize);
+		whole.update(message.data(), message.size());
+		whole.final(expected);
+
+		// stop anywhere, save, and resume in another hasher from the offset it reports
+		for (size_t stop : { size_t(0), size_t(1), size_t(63), size_t(64), size_t(500), size_t(1000) }) {
+			Hasher first(digestSize);
+			first.update(message.data(), stop);
+
+			byte state[SIZE_OF_HASHER_STATE];
+			first.save(state);
+
+			Hasher second;
+			pass &= second.restore(state, sizeof(state));
+			pass &= second.processed() == stop;
+			second.update(message.data() + second.processed(), message.size() - stop);
+
+			byte digest[64];
+			second.final(digest);
+			pass &= memcmp(digest, expected, digestSize) == 0;
+		}
+	}
+
+	Hasher hasher;
+	hasher.update(message.data(), 100);
+
+	byte state[SIZE_OF_HASHER_STATE];
+	hasher.save(state);
+
+	// damaged blobs are refused and the hasher keeps its state
+	const std::pair<size_t, byte> damages[] = {
+		{ 0, 'X' },  // magic
+		{ 4, 2 },    // version
+		{ 5, 48 },   // digest size
+		{ 6, 64 },   // buffered bytes
+		{ 8, 101 },  // byte count
+		{ 80, 1 },   // N, not a whole block
+	};
+
+	for (auto [offset, value] : damages) {
+		byte damaged[SIZE_OF_HASHER_STATE];
+		memcpy(damaged, state, sizeof(damaged));
+		damaged[offset] = value;
+
+		Hasher other;
+		other.update(message.data(), 7);
+		pass &= !other.restore(damaged, sizeof(damaged));
+		pass &= other.processed() == 7;
+	}
+
+	Hasher other;
+	pass &= !other.restore(state, sizeof(state) - 1);
+
+	return pass;
+}
+
+static bool runTreeHashTests()
+{
+	bool pass = true;
+
+	std::vector<byte> data(10000);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<byte>(i * 13 + 7);
+	}
+
+	byte result[SIZE_OF_TREE_HASH];
+
+	// a single leaf is H(2 || params || H(0 || data)) in the byte string convention of update()
+	pass &= Hasher::treeHash(data.data(), 100, result, 1024, 4);
+	{
+		byte leaf[64];
+		const byte leafTag = 0;
+		Hasher hasher;
+		hasher.update(&leafTag, 1);
+		hasher.update(data.data(), 100);
+		hasher.final(leaf);
+
+		const byte root[] = { 2, 0, 4, 0, 0, 0, 0, 0, 0, 4, 100, 0, 0, 0, 0, 0, 0, 0 };
+		byte expected[64];
+		hasher.update(root, sizeof(root));
+		hasher.update(leaf, 64);
+		hasher.final(expected);
+
+		pass &= memcmp(result, root + 1, 9) == 0;
+		pass &= memcmp(result + 9, expected, 64) == 0;
+	}
+
+	// several levels, with the last leaf and the last node short
+	pass &= Hasher::treeHash(data.data(), data.size(), result, 1024, 3);
+	pass &= Hasher::treeHashMatches(data.data(), data.size(), result);
+	pass &= !Hasher::treeHashMatches(data.data(), data.size() - 1, result);
+
+	data[5000] ^= 1;
+	pass &= !Hasher::treeHashMatches(data.data(), data.size(), result);
+	data[5000] ^= 1;
+
+	byte other[SIZE_OF_TREE_HASH];
+	pass &= Hasher::treeHash(data.data(), data.size(), other, 1024, 4);
+	pass &= memcmp(result + 9, other + 9, 64) != 0;
+
+	pass &= Hasher::treeHash(data.data(), 0, result);
+	pass &= Hasher::treeHashMatches(data.data(), 0, result);
+
+	pass &= !Hasher::treeHash(data.data(), data.size(), result, 0, 4);
+	pass &= !Hasher::treeHash(data.data(), data.size(), result, 1024, 1);
+
+	// parameters outside the limits, also when they come with a result to check. The sizes alone
+	// are rejected, the data is never read
+	pass &= !Hasher::treeHash(data.data(), data.size(), result, TREE_MIN_LEAF - 1, 4);
+	pass &= Hasher::treeHash(data.data(), data.size(), result, 1024, 4);
+	result[0] = 1;
+	result[1] = 0;
+	pass &= !Hasher::treeHashMatches(data.data(), data.size(), result);
+	// the largest leafSize is one leaf, size + leafSize does not wrap around
+	memset(result, 0xFF, 8);
+	pass &= !Hasher::treeHashMatches(data.data(), data.size(), result);
+
+	if constexpr (sizeof(size_t) >= 8) {
+		const size_t huge = static_cast<size_t>(TREE_MIN_LEAF * TREE_MAX_LEAVES + 1);
+		pass &= !Hasher::treeHash(data.data(), huge, result, TREE_MIN_LEAF, 4);
+	}
+
+	return pass;
+}
+
+static bool runHmacTests()
+{
+	// RFC 7836, 4.1.1 and 4.1.2
+	const std::vector<byte> key = fromHex("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+	const std::vector<byte> data = fromHex("0126bdb87800af214341456563780100");
+
+	bool pass = true;
+
+	byte mac[64];
+
+	const Hmac hmac256(key.data(), key.size(), 32);
+	hmac256.compute(data.data(), data.size(), mac);
+	pass &= memcmp(mac, fromHex("a1aa5f7de402d7b3d323f2991c8d4534013137010a83754fd0af6d7cd4922ed9").data(), 32) == 0;
+
+	const Hmac hmac512(key.data(), key.size());
+	hmac512.compute(data.data(), data.size(), mac);
+	pass &= memcmp(mac, fromHex(
+		"a59bab22ecae19c65fbde6e5f4e9f5d8549d31f037f9df9b905500e171923a77"
+		"3d5f1530f2ed7e964cb2eedc29e9ad2f3afe93b2814f79f5000ffc0366c251e6").data(), 64) == 0;
+
+	// the prepared key is reusable
+	byte again[64];
+	hmac512.compute(data.data(), data.size(), again);
+	pass &= memcmp(mac, again, 64) == 0;
+
+	// a key longer than a block is hashed first
+	std::vector<byte> longKey(100, 0x42);
+	byte hashedKey[64];
+	Hasher hasher;
+	hasher.update(longKey.data(), longKey.size());
+	hasher.final(hashedKey);
+
+	Hmac(longKey.data(), longKey.size()).compute(data.data(), data.size(), mac);
+	Hmac(hashedKey, 64).compute(data.data(), data.size(), again);
+	pass &= memcmp(mac, again, 64) == 0;
+
+	// only the 64- and 32-byte variants exist
+	for (size_t digestSize : { 0, 48, 100 }) {
+		bool thrown = false;
+		try {
+			Hmac(hashedKey, 64, digestSize);
+		}
+		catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		pass &= thrown;
+	}
+
+	return pass;
+}
+
+static bool runPbkdf2Tests()
+{
+	// R 50.1.111-2016 examples
+	const std::string password = "password";
+	const std::string salt = "salt";
+	const auto P = reinterpret_cast<const byte*>(password.data());
+	const auto S = reinterpret_cast<const byte*>(salt.data());
+
+	const std::pair<u64, const char*> tests[] = {
+		{ 1, "64770af7f748c3b1c9ac831dbcfd85c26111b30a8a657ddc3056b80ca73e040d"
+		     "2854fd36811f6d825cc4ab66ec0a68a490a9e5cf5156b3a2b7eecddbf9a16b47" },
+		{ 2, "5a585bafdfbb6e8830d6d68aa3b43ac00d2e4aebce01c9b31c2caed56f0236d4"
+		     "d34b2b8fbd2c4e89d54d46f50e47d45bbac301571743119e8d3c42ba66d348de" },
+	};
+
+	bool pass = true;
+
+	for (auto [iterations, expected] : tests) {
+		byte dk[64];
+		pass &= pbkdf2(P, password.size(), S, salt.size(), iterations, dk, sizeof(dk));
+		pass &= memcmp(dk, fromHex(expected).data(), 64) == 0;
+	}
+
+	// the batch gives what the single calls give, for several output blocks and a short last one
+	std::vector<std::string> passwords;
+	std::vector<std::string> salts;
+	std::vector<const byte*> passwordPtrs;
+	std::vector<size_t> passwordSizes;
+	std::vector<const byte*> saltPtrs;
+	std::vector<size_t> saltSizes;
+
+	for (size_t i = 0; i < 11; ++i) {
+		passwords.push_back("password " + std::to_string(i * 7919));
+		salts.push_back(std::string(i * 9, 's'));
+	}
+
+	for (size_t i = 0; i < passwords.size(); ++i) {
+		passwordPtrs.push_back(reinterpret_cast<const byte*>(passwords[i].data()));
+		passwordSizes.push_back(passwords[i].size());
+		saltPtrs.push_back(reinterpret_cast<const byte*>(salts[i].data()));
+		saltSizes.push_back(salts[i].size());
+	}
+
+	std::vector<std::array<byte, 100>> keys(passwords.size());
+	std::vector<byte*> dsts;
+	for (auto& key : keys) {
+		dsts.push_back(key.data());
+	}
+
+	pass &= pbkdf2Many(passwordPtrs.data(), passwordSizes.data(), saltPtrs.data(), saltSizes.data(), passwords.size(), 5, dsts.data(), 100);
+
+	for (size_t i = 0; i < passwords.size(); ++i) {
+		byte expected[100];
+		pass &= pbkdf2(passwordPtrs[i], passwordSizes[i], saltPtrs[i], saltSizes[i], 5, expected, sizeof(expected));
+		pass &= memcmp(keys[i].data(), expected, sizeof(expected)) == 0;
+	}
+
+	// the same example computed in lanes
+	const byte* samePasswords[3] = { P, P, P };
+	const size_t samePasswordSizes[3] = { password.size(), password.size(), password.size() };
+	const byte* sameSalts[3] = { S, S, S };
+	const size_t sameSaltSizes[3] = { salt.size(), salt.size(), salt.size() };
+	byte same[3][64];
+	byte* sameDsts[3] = { same[0], same[1], same[2] };
+
+	pass &= pbkdf2Many(samePasswords, samePasswordSizes, sameSalts, sameSaltSizes, 3, 2, sameDsts, 64);
+	for (const auto& dk : same) {
+		pass &= memcmp(dk, fromHex(tests[1].second).data(), 64) == 0;
+	}
+
+	byte dk[64];
+	pass &= !pbkdf2(P, password.size(), S, salt.size(), 0, dk, sizeof(dk));
+
+	// key verifiers: the batch matches the single calls, and differs from the plain getHash()
+	GostMasterKey first(Secured<std::string>(std::string("first key")));
+	GostMasterKey second(Secured<std::string>(std::string("second key")));
+	GostKeyGuard firstGuard(first);
+	GostKeyGuard secondGuard(second);
+
+	const GostKeyGuard* guards[] = { &firstGuard, &secondGuard };
+	SaltBytes verifierSalts[2];
+	HashBytes verifiers[2];
+	memrandomset(verifierSalts[0]);
+	memrandomset(verifierSalts[1]);
+
+	getHash(guards, verifierSalts, verifiers, 2, 10);
+	pass &= verifiers[0] == getHash(firstGuard, verifierSalts[0], 10);
+	pass &= verifiers[1] == getHash(secondGuard, verifierSalts[1], 10);
+	pass &= verifiers[0] != getHash(firstGuard, verifierSalts[0]);
+
+	return pass;
+}
+
+static bool runKdfTests()
+{
+	// RFC 7836 examples
+	std::vector<byte> key(32);
+	for (size_t i = 0; i < key.size(); ++i) {
+		key[i] = static_cast<byte>(i);
+	}
+	const std::vector<byte> label = fromHex("26bdb878");
+	const std::vector<byte> seed = fromHex("af21434145656378");
+
+	bool pass = true;
+
+	SecuredByteArray<32> derived;
+	kdf256(key.data(), key.size(), label.data(), label.size(), seed.data(), seed.size(), derived);
+	pass &= memcmp(derived.data(), fromHex("a1aa5f7de402d7b3d323f2991c8d4534013137010a83754fd0af6d7cd4922ed9").data(), 32) == 0;
+
+	SecuredByteVector tree{ std::vector<std::byte>(64) };
+	pass &= kdfTree256(key.data(), key.size(), label.data(), label.size(), seed.data(), seed.size(), 1, tree);
+	pass &= memcmp(tree.data(), fromHex("22b6837845c6bef65ea71672b265831086d3c76aebe6dae91cad51d83f79d16b"
+	                                     "074c9330599d7f8d712fca54392f4ddde93751206b3584c8f43f9e6dc51531f9").data(), 64) == 0;
+
+	// L is part of every block, so a longer output does not start with a shorter one
+	SecuredByteVector longer{ std::vector<std::byte>(100) };
+	pass &= kdfTree256(key.data(), key.size(), label.data(), label.size(), seed.data(), seed.size(), 2, longer);
+	pass &= memcmp(longer.data(), tree.data(), 32) != 0;
+
+	// R = 1 numbers 255 blocks at most, and R = 0 none
+	SecuredByteVector tooLong{ std::vector<std::byte>(256 * 32) };
+	pass &= !kdfTree256(key.data(), key.size(), label.data(), label.size(), seed.data(), seed.size(), 1, tooLong);
+	pass &= !kdfTree256(key.data(), key.size(), label.data(), label.size(), seed.data(), seed.size(), 0, longer);
+
+	// the batch gives what the single calls give
+	constexpr size_t count = 300;
+	std::vector<std::vector<byte>> seeds;
+	std::vector<const byte*> labelPtrs(count, label.data());
+	std::vector<size_t> labelSizes(count, label.size());
+	std::vector<const byte*> seedPtrs;
+	std::vector<size_t> seedSizes;
+
+	for (size_t i = 0; i < count; ++i) {
+		seeds.emplace_back(i % 150, static_cast<byte>(i));
+	}
+	for (const auto& s : seeds) {
+		seedPtrs.push_back(s.data());
+		seedSizes.push_back(s.size());
+	}
+
+	std::vector<SecuredByteArray<32>> keys(count);
+	kdf256Many(key.data(), key.size(), labelPtrs.data(), labelSizes.data(), seedPtrs.data(), seedSizes.data(), count, keys.data());
+
+	for (size_t i = 0; i < count; ++i) {
+		kdf256(key.data(), key.size(), label.data(), label.size(), seeds[i].data(), seeds[i].size(), derived);
+		pass &= derived == keys[i];
+	}
+
+	return pass;
+}
+
+static bool runPipelineTests()
+{
+	const crypt::TestCase& test = crypt::getTests()[0];
+
+	bool pass = true;
+
+	for (size_t size : { 0, 1, 63, 64, 65, 1000, 16 * 1024 + 5, 300 * 1024 + 3 }) {
+		std::vector<byte> plain(size);
+		for (size_t i = 0; i < size; ++i) {
+			plain[i] = static_cast<byte>(i * 7 + 3);
+		}
+
+		Crypter c;
+		c.setSync(test.iv);
+		c.setTable(test.table);
+
+		std::vector<byte> crypted(size);
+		byte hash[64];
+		c.cryptData(plain.data(), crypted.data(), size, test.key);
+		Hasher::hash(plain.data(), hash, size);
+
+		std::vector<byte> fused(plain);
+		byte fusedHash[64];
+		c.cryptDataAndHash(fused.data(), fused.data(), size, test.key, fusedHash);
+
+		pass &= fused == crypted;
+		pass &= memcmp(hash, fusedHash, 64) == 0;
+	}
+
+	return pass;
+}
+
+static bool runRecryptTests()
+{
+	const crypt::TestCase& oldTest = crypt::getTests()[0];
+	const crypt::TestCase& newTest = crypt::getTests()[1];
+
+	bool pass = true;
+
+	for (size_t size : { 1, 8, 13, 64 * 1024, 200 * 1024 + 7 }) {
+		std::vector<byte> plain(size);
+		for (size_t i = 0; i < size; ++i) {
+			plain[i] = static_cast<byte>(i * 5 + 1);
+		}
+
+		Crypter c;
+		c.setSync(oldTest.iv);
+		c.setTable(oldTest.table);
+
+		std::vector<byte> data(size);
+		std::vector<byte> expected(size);
+		c.cryptData(plain.data(), data.data(), size, oldTest.key);
+		c.cryptData(plain.data(), expected.data(), size, newTest.key);
+
+		c.recryptData(data.data(), size, oldTest.key, newTest.key);
+		pass &= data == expected;
+	}
+
+	return pass;
+}
+
+static bool runMagmaTests()
+{
+	// GOST R 34.13-2015, A.2.2
+	const std::vector<byte> key = fromHex("ffeeddccbbaa99887766554433221100f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+	const std::vector<byte> plain = fromHex("92def06b3c130a59db54c704f8189d204a98fb2e67a8024c8912409b17b57e41");
+	const std::vector<byte> expected = fromHex("4e98110c97b7b93c3e250d93d6e85d69136d868807b2dbef568eb680ab52a12d");
+
+	// a Crypter left with the default table, or given another one, still runs Magma
+	Crypter c;
+
+	bool pass = true;
+
+	std::vector<byte> crypted(plain.size());
+	c.cryptCtr(plain.data(), crypted.data(), plain.size(), key.data(), 0x12345678);
+	pass &= crypted == expected;
+
+	Crypter other;
+	other.setTable(crypt::getTests()[0].get().table);
+	other.cryptCtr(plain.data(), crypted.data(), plain.size(), key.data(), 0x12345678);
+	pass &= crypted == expected;
+
+	// a long message goes through all the chunked and batched paths
+	std::vector<byte> data(200 * 1024 + 5);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<byte>(i * 3);
+	}
+
+	std::vector<byte> whole(data.size());
+	c.cryptCtr(data.data(), whole.data(), data.size(), key.data(), 0xdeadbeef);
+
+	std::vector<byte> roundtrip(data.size());
+	c.cryptCtr(whole.data(), roundtrip.data(), data.size(), key.data(), 0xdeadbeef);
+	pass &= roundtrip == data;
+
+	return pass;
+}
+
+static bool runAcpkmTests()
+{
+	// RFC 8645, A.1: Magma CTR-ACPKM with 16-byte sections
+	const std::vector<byte> key = fromHex("8899aabbccddeeff0011223344556677fedcba98765432100123456789abcdef");
+	const std::vector<byte> plain = fromHex(
+		"1122334455667700ffeeddccbbaa998800112233445566778899aabbcceeff0a"
+		"112233445566778899aabbcceeff0a002233445566778899aabbcceeff0a0011");
+	const std::vector<byte> expected = fromHex(
+		"2ab81deeeb1e4cab68e104c4bd6b94eac72c67af6c2e5b6b0eafb61770f1b32e"
+		"a1ae71149eed1382abd467180672ec6f84a2f15b3fca72c15559fbd38c4c7c5d");
+
+	Crypter c;
+
+	bool pass = true;
+
+	std::vector<byte> crypted(plain.size());
+	pass &= c.cryptCtrAcpkm(plain.data(), crypted.data(), plain.size(), key.data(), 0x12345678, 16);
+	pass &= crypted == expected;
+
+	// sections that are empty or not whole blocks
+	pass &= !c.cryptCtrAcpkm(plain.data(), crypted.data(), plain.size(), key.data(), 0x12345678, 0);
+	pass &= !c.cryptCtrAcpkm(plain.data(), crypted.data(), plain.size(), key.data(), 0x12345678, 12);
+
+	// many sections spread over several workers
+	std::vector<byte> data(300 * 1024 + 3);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<byte>(i * 11);
+	}
+
+	std::vector<byte> whole(data.size());
+	c.cryptCtrAcpkm(data.data(), whole.data(), data.size(), key.data(), 0x12345678, 16);
+	std::vector<byte> roundtrip(data.size());
+	c.cryptCtrAcpkm(whole.data(), roundtrip.data(), data.size(), key.data(), 0x12345678, 16);
+	pass &= roundtrip == data;
+
+	// the same for several windows of section keys, against digests of the output of the
+	// implementation that derived every key up front
+	const std::vector<byte> key2 = [] {
+		std::vector<byte> k(32);
+		for (size_t i = 0; i < k.size(); ++i) {
+			k[i] = static_cast<byte>(i * 5 + 1);
+		}
+		return k;
+	}();
+	const std::pair<size_t, const char*> digests[] = {
+		{ 8, "df9a3b397f904f14189630e3dda39940dcb7d4cd64366c9aff31690eb6f59cd2" },
+		{ 16, "f7689980322beb90857b958ceae6e446e5286f221c9187f6bb3c30b1f6e0c443" },
+		{ 4096, "5a733d6dad843461214a9422180b5c61295ffac2dc1cfb193d31416f5a5e38b6" },
+	};
+	for (const auto& [sectionSize, digest] : digests) {
+		pass &= c.cryptCtrAcpkm(data.data(), whole.data(), data.size(), key2.data(), 0x12345678, sectionSize);
+		byte hash[64];
+		Hasher::hash(whole.data(), hash, whole.size());
+		pass &= std::vector<byte>(hash, hash + 32) == fromHex(digest);
+	}
+
+	return pass;
+}
+
+static bool runMgmTests()
+{
+	// RFC 9058, A.2
+	const std::vector<byte> key = fromHex("ffeeddccbbaa99887766554433221100f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+	const std::vector<byte> nonce = fromHex("12def06b3c130a59");
+	const std::vector<byte> ad = fromHex("01010101010101010202020202020202030303030303030304040404040404040505050505050505ea");
+	const std::vector<byte> plain = fromHex(
+		"ffeeddccbbaa998811223344556677008899aabbcceeff0a001122334455667799aabbcceeff0a00"
+		"1122334455667788aabbcceeff0a00112233445566778899aabbcc");
+	const std::vector<byte> expected = fromHex(
+		"c795066c5f9ea03b85113342459185ae1f2e00d6bf2b785d940470b8bb9c8e7d9a5dd3731f7ddc70"
+		"ec27cb0ace6fa57670f65c646abb75d547aa37c3bcb5c34e03bb9c");
+	const std::vector<byte> expectedTag = fromHex("a7928069aa10fd10");
+
+	Crypter c;
+
+	bool pass = true;
+
+	std::vector<byte> crypted(plain.size());
+	byte tag[8];
+	c.mgmEncrypt(plain.data(), crypted.data(), plain.size(), ad.data(), ad.size(), key.data(), nonce.data(), tag);
+	pass &= crypted == expected;
+	pass &= memcmp(tag, expectedTag.data(), 8) == 0;
+
+	std::vector<byte> decrypted(plain.size());
+	pass &= c.mgmDecrypt(crypted.data(), decrypted.data(), crypted.size(), ad.data(), ad.size(), key.data(), nonce.data(), tag);
+	pass &= decrypted == plain;
+
+	crypted[5] ^= 1;
+	pass &= !c.mgmDecrypt(crypted.data(), decrypted.data(), crypted.size(), ad.data(), ad.size(), key.data(), nonce.data(), tag);
+
+	// large ad and data split between workers, decrypted in place
+	std::vector<byte> bigAd(150 * 1024 + 1, 0x5a);
+	std::vector<byte> data(200 * 1024 + 3);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<byte>(i * 13);
+	}
+
+	std::vector<byte> big(data.size());
+	c.mgmEncrypt(data.data(), big.data(), data.size(), bigAd.data(), bigAd.size(), key.data(), nonce.data(), tag);
+	pass &= c.mgmDecrypt(big.data(), big.data(), big.size(), bigAd.data(), bigAd.size(), key.data(), nonce.data(), tag);
+	pass &= big == data;
+
+	// lengths at the limit of the last block. Pages of calloc() stay unmapped while they are only read
+	byte* zeros = static_cast<byte*>(calloc(MGM_MAX_SIZE + 1, 1));
+	if (zeros) {
+		pass &= c.mgmEncrypt(zeros, zeros, 0, zeros, MGM_MAX_SIZE, key.data(), nonce.data(), tag);
+		pass &= !c.mgmEncrypt(zeros, zeros, 0, zeros, MGM_MAX_SIZE + 1, key.data(), nonce.data(), tag);
+		pass &= !c.mgmEncrypt(zeros, zeros, 1, zeros, MGM_MAX_SIZE, key.data(), nonce.data(), tag);
+		pass &= !c.mgmDecrypt(zeros, zeros, MGM_MAX_SIZE + 1, zeros, 0, key.data(), nonce.data(), tag);
+		free(zeros);
+	}
+
+	return pass;
+}
+
+static bool runKeyWrapTests()
+{
+	const crypt::TestCase& test = crypt::getTests()[0];
+
+	Crypter c;
+	c.setTable(test.table);
+
+	const size_t n = 300;
+	std::vector<MasterKeyBytes> keys(n);
+	std::vector<UkmBytes> ukms(n);
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < SIZE_OF_KEY; ++j) {
+			keys[i][j] = std::byte(i * 31 + j);
+		}
+		for (size_t j = 0; j < SIZE_OF_UKM; ++j) {
+			ukms[i][j] = static_cast<byte>(i * 7 + j * 3);
+		}
+	}
+
+	bool pass = true;
+
+	std::vector<WrappedKey> wrapped(n);
+	c.wrapKeys(keys.data(), test.key, ukms.data(), wrapped.data(), n);
+
+	// lanes of a batch agree with keys wrapped one by one
+	for (size_t i : { 0, 9, 255, 299 }) {
+		WrappedKey single;
+		c.wrapKey(keys[i], test.key, ukms[i], single);
+		pass &= single == wrapped[i];
+		pass &= memcmp(single.data(), ukms[i].data(), SIZE_OF_UKM) == 0;
+		pass &= memcmp(single.data() + SIZE_OF_UKM, keys[i].data(), SIZE_OF_KEY) != 0;
+	}
+
+	std::vector<MasterKeyBytes> unwrapped(n);
+	std::unique_ptr<bool[]> ok(new bool[n]);
+	c.unwrapKeys(wrapped.data(), test.key, unwrapped.data(), ok.get(), n);
+	for (size_t i = 0; i < n; ++i) {
+		pass &= ok[i] && unwrapped[i] == keys[i];
+	}
+
+	MasterKeyBytes key;
+	wrapped[1][SIZE_OF_UKM + 3] ^= 1;
+	pass &= !c.unwrapKey(wrapped[1], test.key, key);
+	pass &= c.unwrapKey(wrapped[2], test.key, key) && key == keys[2];
+	pass &= !c.unwrapKey(wrapped[2], crypt::getTests()[1].get().key, key);
+
+	// known answers computed with the GOST 28147-89 ECB, CFB and MAC of libgcrypt 1.10,
+	// under id-Gost28147-89-CryptoPro-A-ParamSet and id-tc26-gost-28147-param-Z
+	static const byte cryptoProA[8][16] = {
+		{ 0x9, 0x6, 0x3, 0x2, 0x8, 0xb, 0x1, 0x7, 0xa, 0x4, 0xe, 0xf, 0xc, 0x0, 0xd, 0x5 },
+		{ 0x3, 0x7, 0xe, 0x9, 0x8, 0xa, 0xf, 0x0, 0x5, 0x2, 0x6, 0xc, 0xb, 0x4, 0xd, 0x1 },
+		{ 0xe, 0x4, 0x6, 0x2, 0xb, 0x3, 0xd, 0x8, 0xc, 0xf, 0x5, 0xa, 0x0, 0x7, 0x1, 0x9 },
+		{ 0xe, 0x7, 0xa, 0xc, 0xd, 0x1, 0x3, 0x9, 0x0, 0x2, 0xb, 0x4, 0xf, 0x8, 0x5, 0x6 },
+		{ 0xb, 0x5, 0x1, 0x9, 0x8, 0xd, 0xf, 0x0, 0xe, 0x4, 0x2, 0x3, 0xc, 0x7, 0xa, 0x6 },
+		{ 0x3, 0xa, 0xd, 0xc, 0x1, 0x2, 0x0, 0xb, 0x7, 0x5, 0x9, 0x4, 0x8, 0xf, 0xe, 0x6 },
+		{ 0x1, 0xd, 0x2, 0x9, 0x7, 0xa, 0x6, 0x0, 0x8, 0xc, 0x4, 0x5, 0xf, 0x3, 0xb, 0xe },
+		{ 0xb, 0xa, 0xf, 0x5, 0x0, 0xc, 0xe, 0x8, 0x6, 0x2, 0x3, 0x9, 0x1, 0x7, 0xd, 0x4 },
+	};
+
+	struct WrapVector
+	{
+		bool magma;
+		const char* kek;
+		const char* cek;
+		const char* wrapped; // ukm | encrypted key | MAC
+	};
+
+	const WrapVector vectors[] = {
+		{ false, "05162738495a6b7c8d9eafc0d1e2f30415263748596a7b8c9daebfd0e1f20314",
+			"a0a3a6a9acafb2b5b8bbbec1c4c7cacdd0d3d6d9dcdfe2e5e8ebeef1f4f7fafd",
+			"1122334455667788460133948542b72e47e623997a06976ebb19bf48199377a0bc5a5f839c9c680f10f1bdf8" },
+		{ false, "061728394a5b6c7d8e9fb0c1d2e3f405162738495a6b7c8d9eafc0d1e2f30415",
+			"c9cccfd2d5d8dbdee1e4e7eaedf0f3f6f9fcff0205080b0e1114171a1d202326",
+			"2e3f5061728394a531c46c6946919a4603a72ec3088c31e98336ee988e647c2a7627dfdeede9fd9a028af11b" },
+		{ true, "05162738495a6b7c8d9eafc0d1e2f30415263748596a7b8c9daebfd0e1f20314",
+			"a0a3a6a9acafb2b5b8bbbec1c4c7cacdd0d3d6d9dcdfe2e5e8ebeef1f4f7fafd",
+			"11223344556677885d2e7a99f892b30c4f0220818b65805aae50fddf82cf7ea0aaeb50689718cca49e47c463" },
+		{ true, "0718293a4b5c6d7e8fa0b1c2d3e4f5061728394a5b6c7d8e9fb0c1d2e3f40516",
+			"f2f5f8fbfe0104070a0d101316191c1f2225282b2e3134373a3d404346494c4f",
+			"4b5c6d7e8fa0b1c240af6b035321fab75f34df13b3d4a574042c4d1c80bd246a1c40fa919bd6a7a13de5654a" },
+	};
+
+	for (const WrapVector& v : vectors) {
+		if (v.magma) {
+			c.useMagmaTable();
+		}
+		else {
+			c.setTable(&cryptoProA[0][0]);
+		}
+
+		const std::vector<byte> kek = fromHex(v.kek);
+		const std::vector<byte> cek = fromHex(v.cek);
+		const std::vector<byte> expected = fromHex(v.wrapped);
+
+		MasterKeyBytes plainKey;
+		memcpy(plainKey.data(), cek.data(), SIZE_OF_KEY);
+		UkmBytes ukm;
+		memcpy(ukm.data(), expected.data(), SIZE_OF_UKM);
+
+		WrappedKey single;
+		c.wrapKey(plainKey, kek.data(), ukm, single);
+		pass &= std::vector<byte>(single.begin(), single.end()) == expected;
+
+		memcpy(single.data(), expected.data(), SIZE_OF_WRAPPED_KEY);
+		pass &= c.unwrapKey(single, kek.data(), key) && key == plainKey;
+	}
+
+	return pass;
+}
+
+static bool runKuznyechikTests()
+{
+	// GOST R 34.12-2015, A.1 and GOST R 34.13-2015, A.1.2
+	const std::vector<byte> key = fromHex("8899aabbccddeeff0011223344556677fedcba98765432100123456789abcdef");
+	const std::vector<byte> plain = fromHex(
+		"1122334455667700ffeeddccbbaa998800112233445566778899aabbcceeff0a"
+		"112233445566778899aabbcceeff0a002233445566778899aabbcceeff0a0011");
+	const std::vector<byte> expected = fromHex(
+		"f195d8bec10ed1dbd57b5fa240bda1b885eee733f6a13e5df33ce4b33c45dee4"
+		"a5eae88be6356ed3d5e877f13564a3a5cb91fab1f20cbab6d1c6d15820bdba73");
+
+	bool pass = true;
+
+	byte block[16];
+	Kuznyechik::cryptBlock(plain.data(), block, key.data());
+	pass &= fromHex("7f679d90bebc24305a468d42b9d4edcd") == std::vector<byte>(block, block + 16);
+
+	std::vector<byte> crypted(plain.size());
+	Kuznyechik::cryptCtr(plain.data(), crypted.data(), plain.size(), key.data(), 0x1234567890abcef0);
+	pass &= crypted == expected;
+
+	// a long message goes through all the chunked and batched paths, its gamma
+	// past the first chunk must still be E(iv || block number)
+	std::vector<byte> data(200 * 1024 + 5);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<byte>(i * 3);
+	}
+
+	std::vector<byte> whole(data.size());
+	Kuznyechik::cryptCtr(data.data(), whole.data(), data.size(), key.data(), 0x1234567890abcef0);
+
+	const size_t index = 70 * 1024 / 16;
+	byte counter[16] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xce, 0xf0 };
+	for (size_t i = 0; i < 8; ++i) {
+		counter[15 - i] = static_cast<byte>(index >> (i * 8));
+	}
+
+	Kuznyechik::cryptBlock(counter, block, key.data());
+	for (size_t i = 0; i < 16; ++i) {
+		pass &= (whole[index * 16 + i] ^ data[index * 16 + i]) == block[i];
+	}
+
+	std::vector<byte> roundtrip(data.size());
+	Kuznyechik::cryptCtr(whole.data(), roundtrip.data(), data.size(), key.data(), 0x1234567890abcef0);
+	pass &= roundtrip == data;
+
+	return pass;
+}
+
+static bool runConstHashTests()
+{
+	bool pass = true;
+
+	// computed by the compiler
+	constexpr auto constant512 = constHash("The quick brown fox jumps over the lazy dog");
+	constexpr auto constant256 = constHash<32>("The quick brown fox jumps over the lazy dog");
+
+	const std::string fox = "The quick brown fox jumps over the lazy dog";
+	byte expected[64];
+
+	Hasher hasher;
+	hasher.update(reinterpret_cast<const byte*>(fox.data()), fox.size());
+	hasher.final(expected);
+	pass &= memcmp(constant512.data(), expected, 64) == 0;
+
+	Hasher hasher256(32);
+	hasher256.update(reinterpret_cast<const byte*>(fox.data()), fox.size());
+	hasher256.final(expected);
+	pass &= memcmp(constant256.data(), expected, 32) == 0;
+
+	// the same code at run time, for every length up to a few blocks
+	std::vector<byte> message(200);
+	for (size_t i = 0; i < message.size(); ++i) {
+		message[i] = static_cast<byte>(i * 17 + 3);
+	}
+
+	for (size_t size = 0; size <= message.size(); ++size) {
+		hasher.update(message.data(), size);
+		hasher.final(expected);
+		pass &= memcmp(constHash(message.data(), size).data(), expected, 64) == 0;
+
+		hasher256.update(message.data(), size);
+		hasher256.final(expected);
+		pass &= memcmp(constHash<32>(message.data(), size).data(), expected, 32) == 0;
+	}
+
+	return pass;
+}
+
+static bool runMultiHashTests()
+{
+	bool pass = true;
+
+	// messages of every length up to a few blocks, more of them than there are lanes
+	std::vector<std::vector<byte>> messages(200);
+	std::vector<const byte*> srcs;
+	std::vector<size_t> sizes;
+
+	for (size_t i = 0; i < messages.size(); ++i) {
+		messages[i].resize(i * 37 % 300);
+		for (size_t j = 0; j < messages[i].size(); ++j) {
+			messages[i][j] = static_cast<byte>(i * 5 + j * 3);
+		}
+		srcs.push_back(messages[i].data());
+		sizes.push_back(messages[i].size());
+	}
+
+	for (size_t digestSize : { 64, 32 }) {
+		std::vector<std::array<byte, 64>> hashes(messages.size());
+		std::vector<byte*> dsts;
+		for (auto& hash : hashes) {
+			dsts.push_back(hash.data());
+		}
+
+		pass &= Hasher::hashMany(srcs.data(), sizes.data(), dsts.data(), messages.size(), digestSize);
+
+		for (size_t i = 0; i < messages.size(); ++i) {
+			byte expected[64];
+			if (digestSize == 64) {
+				Hasher::hash(srcs[i], expected, sizes[i]);
+			}
+			else {
+				Hasher::hash256(srcs[i], expected, sizes[i]);
+			}
+			pass &= memcmp(hashes[i].data(), expected, digestSize) == 0;
+		}
+	}
+
+	// other digest sizes are refused and leave the outputs alone
+	std::vector<std::array<byte, 64>> untouched(messages.size(), std::array<byte, 64>{});
+	std::vector<byte*> untouchedPtrs;
+	for (auto& hash : untouched) {
+		untouchedPtrs.push_back(hash.data());
+	}
+	for (size_t digestSize : { 0, 48, 100 }) {
+		pass &= !Hasher::hashMany(srcs.data(), sizes.data(), untouchedPtrs.data(), messages.size(), digestSize);
+	}
+	pass &= std::all_of(untouched.begin(), untouched.end(), [](const std::array<byte, 64>& hash) {
+		return std::all_of(hash.begin(), hash.end(), [](byte b) { return b == 0; });
+	});
+
+	// the batch getHash() matches the single one
+	std::vector<std::unique_ptr<GostMasterKey>> keys;
+	std::vector<std::unique_ptr<GostKeyGuard>> guards;
+	std::vector<const GostKeyGuard*> guardPtrs;
+	std::vector<SaltBytes> salts(11);
+	std::vector<HashBytes> hashes(salts.size());
+
+	for (size_t i = 0; i < salts.size(); ++i) {
+		keys.push_back(std::make_unique<GostMasterKey>(Secured<std::string>(std::string("password ") + std::to_string(i))));
+		guards.push_back(std::make_unique<GostKeyGuard>(*keys.back()));
+		guardPtrs.push_back(guards.back().get());
+		memrandomset(salts[i]);
+	}
+
+	getHash(guardPtrs.data(), salts.data(), hashes.data(), salts.size());
+
+	for (size_t i = 0; i < salts.size(); ++i) {
+		pass &= getHash(*guards[i], salts[i]) == hashes[i];
+	}
+
+	return pass;
+}
+
+static bool runVerifyTests()
+{
+	bool pass = true;
+
+	// more credentials than one thread of hashMany() takes, every third of them wrong in one byte
+	constexpr size_t count = 600;
+	std::vector<std::unique_ptr<GostMasterKey>> keys;
+	std::vector<std::unique_ptr<GostKeyGuard>> guards;
+	std::vector<const GostKeyGuard*> guardPtrs;
+	std::vector<SaltBytes> salts(count);
+	std::vector<HashBytes> expected(count);
+
+	for (size_t i = 0; i < count; ++i) {
+		keys.push_back(std::make_unique<GostMasterKey>(Secured<std::string>(std::string("user ") + std::to_string(i))));
+		guards.push_back(std::make_unique<GostKeyGuard>(*keys.back()));
+		guardPtrs.push_back(guards.back().get());
+		memrandomset(salts[i]);
+	}
+
+	getHash(guardPtrs.data(), salts.data(), expected.data(), count);
+	for (size_t i = 0; i < count; i += 3) {
+		expected[i][i % SIZE_OF_HASH] ^= std::byte{ 0x80 };
+	}
+
+	std::vector<u64> matches((count + 63) / 64, ~u64(0));
+	verifyHash(guardPtrs.data(), salts.data(), expected.data(), count, matches.data());
+
+	for (size_t i = 0; i < count; ++i) {
+		pass &= ((matches[i / 64] >> (i % 64) & 1) != 0) == (i % 3 != 0);
+	}
+	// the bits past the last credential are clear
+	pass &= matches.back() >> (count % 64) == 0;
+
+	// PBKDF2 verifiers
+	constexpr size_t verifiers = 5;
+	std::vector<HashBytes> stored(verifiers);
+	getHash(guardPtrs.data(), salts.data(), stored.data(), verifiers, 10);
+	stored[1][63] ^= std::byte{ 1 };
+
+	u64 verified = 0;
+	verifyHash(guardPtrs.data(), salts.data(), stored.data(), verifiers, 10, &verified);
+	pass &= verified == 0b11101;
+
+	return pass;
+}
+
+static bool runSecureArenaTests()
+{
+	bool pass = true;
+
+	// every chunk size and dedicated mappings, the memory is writable and blocks do not overlap
+	std::vector<std::pair<byte*, size_t>> blocks;
+	for (size_t size : {1, 31, 32, 33, 100, 1000, 4096, 40000, 65536, 65537, 300000}) {
+		for (int i = 0; i < 3; ++i) {
+			byte* p = static_cast<byte*>(lockedAlloc(size));
+			pass &= p != nullptr && reinterpret_cast<uintptr_t>(p) % LOCKED_ALIGNMENT == 0;
+			if (p) {
+				memset(p, static_cast<int>(blocks.size()), size);
+				blocks.emplace_back(p, size);
+			}
+		}
+	}
+	for (size_t i = 0; i < blocks.size(); ++i) {
+		const auto [p, size] = blocks[i];
+		pass &= std::all_of(p, p + size, [i](byte b) { return b == static_cast<byte>(i); });
+		lockedFree(p, size);
+	}
+
+	// mixed sizes over several regions, the ends of the regions served as smaller chunks
+	blocks.clear();
+	for (size_t i = 0; i < 200; ++i) {
+		const size_t size = i % 3 == 0 ? 65536 : i % 3 == 1 ? 24576 : 40;
+		byte* p = static_cast<byte*>(lockedAlloc(size));
+		pass &= p != nullptr && reinterpret_cast<uintptr_t>(p) % LOCKED_ALIGNMENT == 0;
+		if (p) {
+			memset(p, static_cast<int>(blocks.size()), size);
+			blocks.emplace_back(p, size);
+		}
+	}
+	for (size_t i = 0; i < blocks.size(); ++i) {
+		const auto [p, size] = blocks[i];
+		pass &= std::all_of(p, p + size, [i](byte b) { return b == static_cast<byte>(i); });
+		lockedFree(p, size);
+	}
+
+	// a freed chunk is wiped and served again
+	byte* chunk = static_cast<byte*>(lockedAlloc(64));
+	memset(chunk, 0xAA, 64);
+	lockedFree(chunk, 64);
+	byte* again = static_cast<byte*>(lockedAlloc(64));
+	pass &= again == chunk;
+	pass &= std::all_of(again + sizeof(void*), again + 64, [](byte b) { return b == 0; });
+	lockedFree(again, 64);
+
+	// a locked vector keeps its contents through reallocations
+	{
+		LockedByteVector v;
+		for (size_t i = 0; i < 200000; ++i) {
+			v.push_back(static_cast<std::byte>(i * 7));
+		}
+		for (size_t i = 0; i < v.size(); ++i) {
+			pass &= v[i] == static_cast<std::byte>(i * 7);
+		}
+
+		LockedByteVector copy(v);
+		pass &= copy == v;
+	}
+
+	// chunks allocated on one thread and freed on another, and threads that exit holding a cache
+	std::vector<std::vector<void*>> handed(4);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < handed.size(); ++t) {
+		threads.emplace_back([&handed, t] {
+			for (size_t i = 0; i < 5000; ++i) {
+				handed[t].push_back(lockedAlloc(32 + i % 200));
+				memset(handed[t].back(), static_cast<int>(t), 32);
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	threads.clear();
+	for (size_t t = 0; t < handed.size(); ++t) {
+		threads.emplace_back([&handed, t] {
+			const std::vector<void*>& mine = handed[(t + 1) % handed.size()];
+			for (size_t i = 0; i < mine.size(); ++i) {
+				lockedFree(mine[i], 32 + i % 200);
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+#if defined(__unix__)
+	// past RLIMIT_MEMLOCK the memory is still served and the failed lock is counted,
+	// unless the process may lock regardless of the limit
+	const pid_t pid = fork();
+	if (pid == 0) {
+		const rlimit none = { 0, 0 };
+		setrlimit(RLIMIT_MEMLOCK, &none);
+
+		const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		void* probe = mmap(nullptr, page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		const bool enforced = probe != MAP_FAILED && mlock(probe, page) != 0;
+
+		const size_t before = lockFailures();
+		void* p = lockedAlloc(300000);
+		const bool counted = lockFailures() == before + (enforced ? 1 : 0);
+		lockedFree(p, 300000);
+		_exit(p != nullptr && counted ? 0 : 1);
+	}
+
+	int status = 0;
+	pass &= pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+
+	return pass;
+}
+
+static bool runRandomTests()
+{
+	bool pass = true;
+
+	// more than a pool and a reseed interval in one call, every byte value about as often as the others
+	std::vector<byte> bulk((1 << 20) + 5000);
+	memrandomset(bulk.data(), bulk.size());
+
+	size_t counts[256] = {};
+	for (byte b : bulk) {
+		++counts[b];
+	}
+	const size_t mean = bulk.size() / 256;
+	for (size_t count : counts) {
+		pass &= count > mean * 3 / 4 && count < mean * 5 / 4;
+	}
+
+	byte first[32];
+	byte second[32];
+	memrandomset(first, sizeof(first));
+	memrandomset(second, sizeof(second));
+	pass &= memcmp(first, second, sizeof(first)) != 0;
+
+	// threads draw at the same time, each from its own generator
+	std::vector<std::array<byte, 64>> results(8);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < results.size(); ++t) {
+		threads.emplace_back([&results, t] {
+			for (int i = 0; i < 1000; ++i) {
+				memrandomset(results[t].data(), results[t].size());
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	for (size_t a = 0; a < results.size(); ++a) {
+		for (size_t b = a + 1; b < results.size(); ++b) {
+			pass &= results[a] != results[b];
+		}
+	}
+
+#if defined(__unix__)
+	// a forked child does not repeat what the parent generates next
+	int fds[2];
+	if (pipe(fds) == 0) {
+		const pid_t pid = fork();
+		if (pid == 0) {
+			byte child[32];
+			memrandomset(child, sizeof(child));
+			_exit(write(fds[1], child, sizeof(child)) == sizeof(child) ? 0 : 1);
+		}
+
+		byte parent[32];
+		byte child[32] = {};
+		memrandomset(parent, sizeof(parent));
+		pass &= read(fds[0], child, sizeof(child)) == sizeof(child);
+		pass &= memcmp(parent, child, sizeof(parent)) != 0;
+
+		waitpid(pid, nullptr, 0);
+		close(fds[0]);
+		close(fds[1]);
+	}
+#endif
+
+	return pass;
 }
 
 static bool runSecureTypesTests()
@@ -153,6 +1390,78 @@ static bool runSecureTypesTests()
 		}
 	}
 
+	// MasterKey guards on several threads at once, nested ones, and more maskings than a remask interval
+	{
+		std::array<std::byte, SIZE_OF_KEY> plain;
+		for (size_t i = 0; i < plain.size(); ++i) {
+			plain[i] = std::byte(i * 11 + 3);
+		}
+		GostMasterKey key(Secured<std::array<std::byte, SIZE_OF_KEY>>{ std::array<std::byte, SIZE_OF_KEY>(plain) });
+
+		std::atomic<bool> pass = true;
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t) {
+			threads.emplace_back([&key, &plain, &pass] {
+				for (int i = 0; i < 20000; ++i) {
+					GostKeyGuard guard(key);
+					if (guard.get() != plain) {
+						pass = false;
+					}
+					if (i % 7 == 0) {
+						GostKeyGuard nested(key);
+						if (nested.get() != plain) {
+							pass = false;
+						}
+					}
+				}
+			});
+		}
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		{
+			GostKeyGuard guard(key);
+			pass = pass && guard.get() == plain;
+		}
+
+		if (!pass) {
+			return false;
+		}
+	}
+
+	// XOR and wipe of every length around the word and vector sizes, at odd offsets
+	{
+		bool pass = true;
+
+		for (size_t size = 0; size <= 80; ++size) {
+			SecuredByteVector a{ std::vector<std::byte>(size) };
+			SecuredByteVector b{ std::vector<std::byte>(size + 3) };
+			for (size_t i = 0; i < b.size(); ++i) {
+				if (i < size) {
+					a[i] = std::byte(i * 7);
+				}
+				b[i] = std::byte(i * 13 + 1);
+			}
+
+			a ^= b;
+			for (size_t i = 0; i < size; ++i) {
+				pass &= a[i] == (std::byte(i * 7) ^ std::byte(i * 13 + 1));
+			}
+
+			memwipe(b.data() + 1, size, 0xA5);
+			pass &= b[0] == std::byte(1);
+			for (size_t i = 1; i <= size; ++i) {
+				pass &= b[i] == std::byte(0xA5);
+			}
+			pass &= b[size + 1] == std::byte((size + 1) * 13 + 1);
+		}
+
+		if (!pass) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -170,6 +1479,25 @@ int main()
 	for (auto&& [test, name] : {
 
 		TestPair{runCryptTests, "CRYPT"},
+		TestPair{runHashTests, "HASH"},
+		TestPair{runConstHashTests, "CONST HASH"},
+		TestPair{runMultiHashTests, "MULTI HASH"},
+		TestPair{runVerifyTests, "VERIFY"},
+		TestPair{runSharedPrefixTests, "SHARED PREFIX"},
+		TestPair{runCheckpointTests, "CHECKPOINT"},
+		TestPair{runTreeHashTests, "TREE HASH"},
+		TestPair{runHmacTests, "HMAC"},
+		TestPair{runPbkdf2Tests, "PBKDF2"},
+		TestPair{runKdfTests, "KDF"},
+		TestPair{runPipelineTests, "PIPELINE"},
+		TestPair{runRecryptTests, "RECRYPT"},
+		TestPair{runMagmaTests, "MAGMA"},
+		TestPair{runAcpkmTests, "ACPKM"},
+		TestPair{runMgmTests, "MGM"},
+		TestPair{runKeyWrapTests, "KEY WRAP"},
+		TestPair{runKuznyechikTests, "KUZNYECHIK"},
+		TestPair{runRandomTests, "RANDOM"},
+		TestPair{runSecureArenaTests, "SECURE ARENA"},
 		TestPair{runSecureTypesTests, "SECURE TYPES"}
 
 	}) {